@@ -0,0 +1,532 @@
+/*******************************************************************************
+ *
+ * @file    bbuffer.c
+ * @brief   Implementation of a byte ring buffer with message framing.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definition of bbuffer_t is intentionally kept private to this
+ *          source file to enforce encapsulation. Users of this module interact
+ *          with the buffer only through the public API and cannot access or
+ *          modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "bbuffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define BBUFFER_ALIGN       (4U)            /* Message alignment in bytes. */
+#define BBUFFER_HDR_SIZE    (4U)            /* Message length header. */
+#define BBUFFER_HDR_PAD     (UINT32_MAX)    /* Header of a wrap-around pad. */
+
+#define BBUFFER_ALIGN_UP(n) \
+    (((n) + (BBUFFER_ALIGN - 1U)) & ~(BBUFFER_ALIGN - 1U))
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Structure representing a byte ring buffer.
+ * @note This structure is opaque to users of the API. Indices and the full
+ * flag follow the same scheme as rbuffer_t, counted in bytes.
+ * @note In message mode every record starts at a multiple of BBUFFER_ALIGN and
+ * is a length header followed by the payload padded to BBUFFER_ALIGN. When a
+ * record does not fit before the end of the buffer, a pad header marks the
+ * rest of the buffer as unused and the record is placed at offset 0.
+ */
+struct bbuffer_t
+{
+    uint8_t *p_buf;
+    uint32_t capacity;
+    uint32_t ridx;          /* Read index. */
+    uint32_t widx;          /* Write index. */
+    uint32_t res_offset;    /* Header offset of the pending reservation. */
+    uint32_t res_len;       /* Payload bytes reserved, 0 if none. */
+    bool b_res_wrap;        /* Reservation needs a pad at widx. */
+    bool b_reserved;
+    bool b_is_full;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void bbuffer_advance(uint32_t *p_idx, uint32_t len, uint32_t capacity);
+static uint32_t bbuffer_get_header(const bbuffer_t *p_bb, uint32_t offset);
+static void bbuffer_put_header(bbuffer_t *p_bb, uint32_t offset,
+                               uint32_t value);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes a byte ring buffer.
+ * @param[in] capacity Number of bytes the buffer can store. Rounded up to a
+ * multiple of 4 so that framed messages stay aligned.
+ * @return Pointer to the created buffer, or NULL if capacity is less than 1 or
+ * too large, or if any memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling bbuffer_destroy().
+ */
+bbuffer_t* bbuffer_create(uint32_t capacity)
+{
+    if ((capacity < 1) || (capacity > (UINT32_MAX - BBUFFER_ALIGN)))
+    {
+        return NULL;
+    }
+
+    bbuffer_t *p_bb = malloc(sizeof(bbuffer_t));
+    if (NULL == p_bb)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    capacity = BBUFFER_ALIGN_UP(capacity);
+    p_bb->p_buf = malloc(capacity);
+    if (NULL == p_bb->p_buf)
+    {
+        free(p_bb);
+        return NULL;
+    }
+
+    p_bb->capacity = capacity;
+    p_bb->ridx = 0;
+    p_bb->widx = 0;
+    p_bb->res_offset = 0;
+    p_bb->res_len = 0;
+    p_bb->b_res_wrap = false;
+    p_bb->b_reserved = false;
+    p_bb->b_is_full = false;
+
+    return p_bb;
+} /* End of bbuffer_create() */
+
+/*!
+ * @brief Writes bytes into the buffer.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @param[in] p_src Bytes to write.
+ * @param[in] len Number of bytes in p_src.
+ * @return Number of bytes written, limited by the free space. Never overwrites
+ * unread data. Returns 0 if p_bb or p_src is NULL.
+ * @note Time complexity: O(len), with at most two memcpy() calls.
+ */
+uint32_t bbuffer_write(bbuffer_t *p_bb, const void *p_src, uint32_t len)
+{
+    if (NULL == p_bb || NULL == p_src)
+    {
+        return 0;
+    }
+
+    uint32_t free_count = bbuffer_free_count(p_bb);
+    if (len > free_count)
+    {
+        len = free_count;
+    }
+
+    if (0 == len)
+    {
+        return 0;
+    }
+
+    uint32_t first = p_bb->capacity - p_bb->widx;
+    if (first > len)
+    {
+        first = len;
+    }
+
+    memcpy(&p_bb->p_buf[p_bb->widx], p_src, first);
+    memcpy(p_bb->p_buf, (const uint8_t *)p_src + first, len - first);
+
+    bbuffer_advance(&p_bb->widx, len, p_bb->capacity);
+    if (p_bb->widx == p_bb->ridx)
+    {
+        p_bb->b_is_full = true;
+    }
+
+    return len;
+} /* End of bbuffer_write() */
+
+/*!
+ * @brief Reads and removes bytes from the buffer.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @param[out] p_dst Buffer receiving the bytes.
+ * @param[in] len Capacity of p_dst.
+ * @return Number of bytes read, limited by the stored data. Returns 0 if p_bb
+ * or p_dst is NULL.
+ * @note Time complexity: O(len), with at most two memcpy() calls.
+ */
+uint32_t bbuffer_read(bbuffer_t *p_bb, void *p_dst, uint32_t len)
+{
+    if (NULL == p_bb || NULL == p_dst)
+    {
+        return 0;
+    }
+
+    uint32_t data_count = bbuffer_data_count(p_bb);
+    if (len > data_count)
+    {
+        len = data_count;
+    }
+
+    if (0 == len)
+    {
+        return 0;
+    }
+
+    uint32_t first = p_bb->capacity - p_bb->ridx;
+    if (first > len)
+    {
+        first = len;
+    }
+
+    memcpy(p_dst, &p_bb->p_buf[p_bb->ridx], first);
+    memcpy((uint8_t *)p_dst + first, p_bb->p_buf, len - first);
+
+    bbuffer_advance(&p_bb->ridx, len, p_bb->capacity);
+    p_bb->b_is_full = false;
+
+    return len;
+} /* End of bbuffer_read() */
+
+/*!
+ * @brief Counts the number of bytes stored in the buffer.
+ * @param[in] p_bb Pointer to the byte ring buffer.
+ * @return Number of bytes stored, including framing overhead in message mode.
+ * Returns 0 if p_bb is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t bbuffer_data_count(const bbuffer_t *p_bb)
+{
+    if (NULL == p_bb)
+    {
+        return 0;
+    }
+
+    if (p_bb->widx == p_bb->ridx)
+    {
+        return p_bb->b_is_full ? p_bb->capacity : 0;
+    }
+    else if (p_bb->widx > p_bb->ridx)
+    {
+        return p_bb->widx - p_bb->ridx;
+    }
+    else
+    {
+        return p_bb->capacity - (p_bb->ridx - p_bb->widx);
+    }
+} /* End of bbuffer_data_count() */
+
+/*!
+ * @brief Counts the number of free bytes in the buffer.
+ * @param[in] p_bb Pointer to the byte ring buffer.
+ * @return Number of bytes available for writing. Returns 0 if p_bb is NULL.
+ * @note Time complexity: O(1)
+ * @note In message mode, a message of this size may still not fit because it
+ * needs a header and contiguous space.
+ */
+uint32_t bbuffer_free_count(const bbuffer_t *p_bb)
+{
+    if (NULL == p_bb)
+    {
+        return 0;
+    }
+
+    return p_bb->capacity - bbuffer_data_count(p_bb);
+} /* End of bbuffer_free_count() */
+
+/*!
+ * @brief Checks whether the buffer is empty.
+ * @param[in] p_bb Pointer to the byte ring buffer.
+ * @return true If the buffer is empty.
+ * @return false If the buffer contains data, or if p_bb is NULL.
+ * @note Time complexity: O(1)
+ */
+bool bbuffer_is_empty(const bbuffer_t *p_bb)
+{
+    if (NULL == p_bb)
+    {
+        return false;
+    }
+
+    return (p_bb->widx == p_bb->ridx && !p_bb->b_is_full);
+} /* End of bbuffer_is_empty() */
+
+/*!
+ * @brief Checks whether the buffer is full.
+ * @param[in] p_bb Pointer to the byte ring buffer.
+ * @return true If the buffer is full.
+ * @return false If the buffer has free space, or if p_bb is NULL.
+ * @note Time complexity: O(1)
+ */
+bool bbuffer_is_full(const bbuffer_t *p_bb)
+{
+    if (NULL == p_bb)
+    {
+        return false;
+    }
+
+    return (p_bb->widx == p_bb->ridx && p_bb->b_is_full);
+} /* End of bbuffer_is_full() */
+
+/*!
+ * @brief Discards all data and any pending reservation.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @return true If the buffer was cleared.
+ * @return false If p_bb is NULL.
+ * @note Time complexity: O(1)
+ */
+bool bbuffer_clear(bbuffer_t *p_bb)
+{
+    if (NULL == p_bb)
+    {
+        return false;
+    }
+
+    p_bb->ridx = 0;
+    p_bb->widx = 0;
+    p_bb->res_len = 0;
+    p_bb->b_reserved = false;
+    p_bb->b_is_full = false;
+
+    return true;
+} /* End of bbuffer_clear() */
+
+/*!
+ * @brief Destroys a byte ring buffer and releases all associated resources.
+ * @param[in] p_bb Pointer to the byte ring buffer.
+ * @note Time complexity: O(1)
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void bbuffer_destroy(bbuffer_t *p_bb)
+{
+    if (NULL == p_bb)
+    {
+        return;
+    }
+
+    free(p_bb->p_buf);
+    free(p_bb);
+} /* End of bbuffer_destroy() */
+
+/*!
+ * @brief Reserves contiguous space for a message payload.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @param[in] max_len Maximum payload size the producer will write.
+ * @return Pointer to max_len contiguous bytes where the payload is to be
+ * written, or NULL if p_bb is NULL, max_len is too large, or there is not
+ * enough contiguous space.
+ * @note Time complexity: O(1)
+ * @note Nothing becomes visible to the consumer until bbuffer_msg_commit().
+ * A new reservation replaces a pending one.
+ */
+uint8_t* bbuffer_msg_reserve(bbuffer_t *p_bb, uint32_t max_len)
+{
+    if (NULL == p_bb)
+    {
+        return NULL;
+    }
+
+    if (max_len > (p_bb->capacity - BBUFFER_HDR_SIZE))
+    {
+        return NULL;
+    }
+
+    uint32_t need = BBUFFER_HDR_SIZE + BBUFFER_ALIGN_UP(max_len);
+
+    p_bb->b_reserved = false;
+
+    if (bbuffer_is_empty(p_bb))
+    {
+        /* Restart at offset 0 to offer the largest contiguous region. */
+        p_bb->ridx = 0;
+        p_bb->widx = 0;
+    }
+
+    if (p_bb->b_is_full)
+    {
+        return NULL;
+    }
+
+    if (p_bb->widx >= p_bb->ridx)
+    {
+        if ((p_bb->capacity - p_bb->widx) >= need)
+        {
+            /* Fits before the end of the buffer. */
+            p_bb->res_offset = p_bb->widx;
+            p_bb->b_res_wrap = false;
+        }
+        else if (p_bb->ridx >= need)
+        {
+            /* Fits at the start once the tail is padded. */
+            p_bb->res_offset = 0;
+            p_bb->b_res_wrap = true;
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+    else
+    {
+        if ((p_bb->ridx - p_bb->widx) < need)
+        {
+            return NULL;
+        }
+        p_bb->res_offset = p_bb->widx;
+        p_bb->b_res_wrap = false;
+    }
+
+    p_bb->res_len = max_len;
+    p_bb->b_reserved = true;
+
+    return &p_bb->p_buf[p_bb->res_offset + BBUFFER_HDR_SIZE];
+} /* End of bbuffer_msg_reserve() */
+
+/*!
+ * @brief Publishes the message written into the pending reservation.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @param[in] len Actual payload size, at most the reserved size.
+ * @return true If the message was committed as a whole.
+ * @return false If p_bb is NULL, there is no pending reservation, or len
+ * exceeds it.
+ * @note Time complexity: O(1)
+ */
+bool bbuffer_msg_commit(bbuffer_t *p_bb, uint32_t len)
+{
+    if (NULL == p_bb)
+    {
+        return false;
+    }
+
+    if (!p_bb->b_reserved || (len > p_bb->res_len))
+    {
+        return false;
+    }
+
+    if (p_bb->b_res_wrap)
+    {
+        /* Mark the unused tail so the consumer skips to offset 0. */
+        bbuffer_put_header(p_bb, p_bb->widx, BBUFFER_HDR_PAD);
+    }
+
+    bbuffer_put_header(p_bb, p_bb->res_offset, len);
+
+    p_bb->widx = p_bb->res_offset;
+    bbuffer_advance(&p_bb->widx, BBUFFER_HDR_SIZE + BBUFFER_ALIGN_UP(len),
+                    p_bb->capacity);
+    if (p_bb->widx == p_bb->ridx)
+    {
+        p_bb->b_is_full = true;
+    }
+
+    p_bb->res_len = 0;
+    p_bb->b_reserved = false;
+
+    return true;
+} /* End of bbuffer_msg_commit() */
+
+/*!
+ * @brief Returns the oldest message without removing it.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @param[out] p_len Pointer to the variable that receives the payload size.
+ * @return Pointer to the contiguous payload, or NULL if p_bb or p_len is NULL
+ * or no message is stored.
+ * @note Time complexity: O(1)
+ * @note Not const: a wrap-around pad in front of the message is dropped. The
+ * payload stays valid until bbuffer_msg_release().
+ */
+const uint8_t* bbuffer_msg_peek(bbuffer_t *p_bb, uint32_t *p_len)
+{
+    if (NULL == p_bb || NULL == p_len)
+    {
+        return NULL;
+    }
+
+    if (bbuffer_is_empty(p_bb))
+    {
+        return NULL;
+    }
+
+    uint32_t header = bbuffer_get_header(p_bb, p_bb->ridx);
+    if (BBUFFER_HDR_PAD == header)
+    {
+        /* A pad is always followed by a message at offset 0. */
+        p_bb->ridx = 0;
+        p_bb->b_is_full = false;
+        header = bbuffer_get_header(p_bb, 0);
+    }
+
+    *p_len = header;
+
+    return &p_bb->p_buf[p_bb->ridx + BBUFFER_HDR_SIZE];
+} /* End of bbuffer_msg_peek() */
+
+/*!
+ * @brief Removes the oldest message.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @return true If a message was removed.
+ * @return false If p_bb is NULL or no message is stored.
+ * @note Time complexity: O(1)
+ */
+bool bbuffer_msg_release(bbuffer_t *p_bb)
+{
+    uint32_t len;
+
+    if (NULL == bbuffer_msg_peek(p_bb, &len))
+    {
+        return false;
+    }
+
+    bbuffer_advance(&p_bb->ridx, BBUFFER_HDR_SIZE + BBUFFER_ALIGN_UP(len),
+                    p_bb->capacity);
+    p_bb->b_is_full = false;
+
+    return true;
+} /* End of bbuffer_msg_release() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Advances an index by len bytes, wrapping at the capacity.
+ * @param[in,out] p_idx Index to advance.
+ * @param[in] len Number of bytes; at most the capacity.
+ * @param[in] capacity Capacity of the buffer.
+ */
+static void bbuffer_advance(uint32_t *p_idx, uint32_t len, uint32_t capacity)
+{
+    *p_idx += len;
+    if (*p_idx >= capacity)
+    {
+        *p_idx -= capacity;
+    }
+} /* End of bbuffer_advance() */
+
+/*!
+ * @brief Reads the message header stored at an aligned offset.
+ * @param[in] p_bb Pointer to the byte ring buffer.
+ * @param[in] offset Offset of the header.
+ * @return The header value.
+ */
+static uint32_t bbuffer_get_header(const bbuffer_t *p_bb, uint32_t offset)
+{
+    uint32_t value;
+
+    memcpy(&value, &p_bb->p_buf[offset], sizeof(value));
+
+    return value;
+} /* End of bbuffer_get_header() */
+
+/*!
+ * @brief Writes a message header at an aligned offset.
+ * @param[in,out] p_bb Pointer to the byte ring buffer.
+ * @param[in] offset Offset of the header.
+ * @param[in] value Payload size, or BBUFFER_HDR_PAD.
+ */
+static void bbuffer_put_header(bbuffer_t *p_bb, uint32_t offset,
+                               uint32_t value)
+{
+    memcpy(&p_bb->p_buf[offset], &value, sizeof(value));
+} /* End of bbuffer_put_header() */
+
+/*** End of file: bbuffer.c */
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * 
+ * @file    bbuffer.h
+ * @brief   Public APIs for a byte ring buffer with message framing.
+ * @details This module provides an opaque ring buffer of bytes. Raw byte
+ *          streams are moved in and out with bulk memcpy() calls, and a
+ *          framing layer stores variable-size messages as a length header
+ *          followed by the payload, always contiguous in memory, so that
+ *          producers can encode in place and consumers can parse in place.
+ *          Users must interact with the buffer only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    A buffer is used either as a byte stream (bbuffer_write() /
+ *          bbuffer_read()) or as a message queue (bbuffer_msg_*()), not both.
+ * 
+ ******************************************************************************/
+
+#ifndef BBUFFER_H
+#define BBUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct bbuffer_t bbuffer_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+bbuffer_t* bbuffer_create(uint32_t capacity);
+uint32_t bbuffer_write(bbuffer_t *p_bb, const void *p_src, uint32_t len);
+uint32_t bbuffer_read(bbuffer_t *p_bb, void *p_dst, uint32_t len);
+uint32_t bbuffer_data_count(const bbuffer_t *p_bb);
+uint32_t bbuffer_free_count(const bbuffer_t *p_bb);
+bool bbuffer_is_empty(const bbuffer_t *p_bb);
+bool bbuffer_is_full(const bbuffer_t *p_bb);
+bool bbuffer_clear(bbuffer_t *p_bb);
+void bbuffer_destroy(bbuffer_t *p_bb);
+
+uint8_t* bbuffer_msg_reserve(bbuffer_t *p_bb, uint32_t max_len);
+bool bbuffer_msg_commit(bbuffer_t *p_bb, uint32_t len);
+const uint8_t* bbuffer_msg_peek(bbuffer_t *p_bb, uint32_t *p_len);
+bool bbuffer_msg_release(bbuffer_t *p_bb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BBUFFER_H */
+
+/*** End of file: bbuffer.h */
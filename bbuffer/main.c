@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * 
+ * @file    main.c 
+ * @brief   Test driver for the byte ring buffer module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * 
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "bbuffer.h"
+
+#define BUFFER_SIZE (32)
+
+static void send(bbuffer_t *p_bb, const char *p_msg)
+{
+    uint32_t len = (uint32_t)strlen(p_msg);
+    uint8_t *p_payload = bbuffer_msg_reserve(p_bb, len);
+
+    if (NULL == p_payload)
+    {
+        printf("no room for \"%s\"\n", p_msg);
+        return;
+    }
+
+    /* Encode in place, then publish the whole message at once. */
+    memcpy(p_payload, p_msg, len);
+    bbuffer_msg_commit(p_bb, len);
+}
+
+static void receive(bbuffer_t *p_bb)
+{
+    uint32_t len;
+    const uint8_t *p_payload = bbuffer_msg_peek(p_bb, &len);
+
+    if (NULL == p_payload)
+    {
+        printf("(none)\n");
+        return;
+    }
+
+    /* Parse in place: the payload is never split by the wrap point. */
+    printf("%.*s\n", (int)len, (const char *)p_payload);
+    bbuffer_msg_release(p_bb);
+}
+
+int main(int argc, char *argv[])
+{
+    uint8_t bytes[BUFFER_SIZE];
+
+    /* Byte stream mode. */
+    bbuffer_t *p_bb = bbuffer_create(BUFFER_SIZE);
+    printf("%u\n", bbuffer_write(p_bb, "hello, ring buffer", 18)); /* 18 */
+    printf("%u\n", bbuffer_read(p_bb, bytes, 7)); /* 7 */
+    printf("%u\n", bbuffer_write(p_bb, "0123456789abcdefghijk", 21)); /* 21 */
+    printf("%d\n", bbuffer_is_full(p_bb)); /* 1 */
+    printf("%u\n", bbuffer_read(p_bb, bytes, sizeof(bytes))); /* 32 */
+    printf("%.32s\n", (char *)bytes); /* ring buffer0123456789abcdefghijk */
+    bbuffer_destroy(p_bb);
+
+    /* Message mode. */
+    p_bb = bbuffer_create(BUFFER_SIZE);
+    send(p_bb, "alpha");        /* 4 + 8 bytes at offset 0. */
+    send(p_bb, "bravo");        /* 4 + 8 bytes at offset 12. */
+    receive(p_bb);              /* alpha */
+    send(p_bb, "charlie");      /* Does not fit at 24: padded, wraps to 0. */
+    receive(p_bb);              /* bravo */
+    receive(p_bb);              /* charlie */
+    receive(p_bb);              /* (none) */
+    send(p_bb, "a message that is too long to fit"); /* no room */
+    bbuffer_destroy(p_bb);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
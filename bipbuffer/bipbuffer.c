@@ -0,0 +1,318 @@
+/*******************************************************************************
+ *
+ * @file    bipbuffer.c
+ * @brief   Implementation of a bipartite (bip) buffer.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definition of bipbuffer_t is intentionally kept private to this
+ *          source file to enforce encapsulation. Users of this module interact
+ *          with the buffer only through the public API and cannot access or
+ *          modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "bipbuffer.h"
+#include <stdlib.h>
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Structure representing a bip buffer.
+ * @note This structure is opaque to users of the API. Committed data lives in
+ * up to two regions: region A, [a_start, a_end), holds the oldest data, and
+ * region B, [0, b_end), is only used once a writer has wrapped to the start
+ * of the buffer. B always ends before A starts, and is promoted to A when A
+ * has been consumed.
+ */
+struct bipbuffer_t
+{
+    uint8_t *p_buf;
+    uint32_t capacity;
+    uint32_t a_start;
+    uint32_t a_end;
+    uint32_t b_end;
+    uint32_t res_start;     /* Start of the pending reservation. */
+    uint32_t res_size;      /* Size of the pending reservation, 0 if none. */
+    bool b_in_use;          /* Region B holds committed data. */
+};
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes a bip buffer.
+ * @param[in] capacity Number of bytes the buffer can store.
+ * @return Pointer to the created buffer, or NULL if capacity is less than 1 or
+ * if any memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling bipbuffer_destroy().
+ */
+bipbuffer_t* bipbuffer_create(uint32_t capacity)
+{
+    if (capacity < 1)
+    {
+        return NULL;
+    }
+
+    bipbuffer_t *p_bip = malloc(sizeof(bipbuffer_t));
+    if (NULL == p_bip)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_bip->p_buf = malloc(capacity);
+    if (NULL == p_bip->p_buf)
+    {
+        free(p_bip);
+        return NULL;
+    }
+
+    p_bip->capacity = capacity;
+    (void)bipbuffer_clear(p_bip);
+
+    return p_bip;
+} /* End of bipbuffer_create() */
+
+/*!
+ * @brief Reserves a contiguous region for writing.
+ * @param[in,out] p_bip Pointer to the bip buffer.
+ * @param[in] size Number of bytes to reserve.
+ * @return Pointer to size contiguous writable bytes, or NULL if p_bip is NULL,
+ * size is 0, or no contiguous free region of that size exists.
+ * @note Time complexity: O(1)
+ * @note The region after region A is used if it is large enough; otherwise
+ * the writer wraps early to the free space before region A. The reservation
+ * is invisible to readers until bipbuffer_commit(). A new reservation replaces
+ * a pending one.
+ */
+uint8_t* bipbuffer_reserve(bipbuffer_t *p_bip, uint32_t size)
+{
+    if (NULL == p_bip || 0 == size)
+    {
+        return NULL;
+    }
+
+    p_bip->res_size = 0;
+
+    if (p_bip->b_in_use)
+    {
+        /* Already wrapped: only the gap between B and A is free. */
+        if ((p_bip->a_start - p_bip->b_end) < size)
+        {
+            return NULL;
+        }
+        p_bip->res_start = p_bip->b_end;
+    }
+    else if ((p_bip->capacity - p_bip->a_end) >= size)
+    {
+        p_bip->res_start = p_bip->a_end;
+    }
+    else if (p_bip->a_start >= size)
+    {
+        /* Wrap early rather than split the region. */
+        p_bip->res_start = 0;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    p_bip->res_size = size;
+
+    return &p_bip->p_buf[p_bip->res_start];
+} /* End of bipbuffer_reserve() */
+
+/*!
+ * @brief Publishes data written into the pending reservation.
+ * @param[in,out] p_bip Pointer to the bip buffer.
+ * @param[in] size Number of bytes actually written, at most the reserved
+ * size. 0 cancels the reservation.
+ * @return true If the data was committed (or the reservation cancelled).
+ * @return false If p_bip is NULL, or size exceeds the pending reservation.
+ * @note Time complexity: O(1)
+ */
+bool bipbuffer_commit(bipbuffer_t *p_bip, uint32_t size)
+{
+    if (NULL == p_bip)
+    {
+        return false;
+    }
+
+    if (size > p_bip->res_size)
+    {
+        return false;
+    }
+
+    if (size > 0)
+    {
+        if (p_bip->a_start == p_bip->a_end)
+        {
+            /* Region A is empty: the committed data becomes region A. */
+            p_bip->a_start = p_bip->res_start;
+            p_bip->a_end = p_bip->res_start + size;
+        }
+        else if (p_bip->res_start == p_bip->a_end)
+        {
+            p_bip->a_end += size;
+        }
+        else
+        {
+            p_bip->b_end = p_bip->res_start + size;
+            p_bip->b_in_use = true;
+        }
+    }
+
+    p_bip->res_size = 0;
+
+    return true;
+} /* End of bipbuffer_commit() */
+
+/*!
+ * @brief Returns the oldest committed data as one contiguous block.
+ * @param[in] p_bip Pointer to the bip buffer.
+ * @param[out] p_size Pointer to the variable that receives the block size.
+ * @return Pointer to the block, or NULL if p_bip or p_size is NULL or the
+ * buffer is empty.
+ * @note Time complexity: O(1)
+ * @note Once the block is consumed, data committed after a wrap becomes the
+ * next block.
+ */
+const uint8_t* bipbuffer_peek_block(const bipbuffer_t *p_bip,
+                                    uint32_t *p_size)
+{
+    if (NULL == p_bip || NULL == p_size)
+    {
+        return NULL;
+    }
+
+    *p_size = p_bip->a_end - p_bip->a_start;
+    if (0 == *p_size)
+    {
+        return NULL;
+    }
+
+    return &p_bip->p_buf[p_bip->a_start];
+} /* End of bipbuffer_peek_block() */
+
+/*!
+ * @brief Releases bytes from the front of the block returned by
+ * bipbuffer_peek_block().
+ * @param[in,out] p_bip Pointer to the bip buffer.
+ * @param[in] size Number of bytes to release.
+ * @return true If the bytes were released.
+ * @return false If p_bip is NULL or size exceeds the current block.
+ * @note Time complexity: O(1)
+ */
+bool bipbuffer_consume(bipbuffer_t *p_bip, uint32_t size)
+{
+    if (NULL == p_bip)
+    {
+        return false;
+    }
+
+    if (size > (p_bip->a_end - p_bip->a_start))
+    {
+        return false;
+    }
+
+    p_bip->a_start += size;
+
+    if (p_bip->a_start == p_bip->a_end)
+    {
+        if (p_bip->b_in_use)
+        {
+            /* Region A is drained: region B takes its place. */
+            p_bip->a_start = 0;
+            p_bip->a_end = p_bip->b_end;
+            p_bip->b_end = 0;
+            p_bip->b_in_use = false;
+        }
+        else if (0 == p_bip->res_size)
+        {
+            /* Empty with no writer in progress: rewind. */
+            p_bip->a_start = 0;
+            p_bip->a_end = 0;
+        }
+    }
+
+    return true;
+} /* End of bipbuffer_consume() */
+
+/*!
+ * @brief Counts the number of committed bytes in the buffer.
+ * @param[in] p_bip Pointer to the bip buffer.
+ * @return Number of committed bytes in both regions. Returns 0 if p_bip is
+ * NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t bipbuffer_data_count(const bipbuffer_t *p_bip)
+{
+    if (NULL == p_bip)
+    {
+        return 0;
+    }
+
+    return (p_bip->a_end - p_bip->a_start) + p_bip->b_end;
+} /* End of bipbuffer_data_count() */
+
+/*!
+ * @brief Checks whether the buffer holds no committed data.
+ * @param[in] p_bip Pointer to the bip buffer.
+ * @return true If the buffer is empty.
+ * @return false If the buffer contains data, or if p_bip is NULL.
+ * @note Time complexity: O(1)
+ */
+bool bipbuffer_is_empty(const bipbuffer_t *p_bip)
+{
+    if (NULL == p_bip)
+    {
+        return false;
+    }
+
+    return (p_bip->a_start == p_bip->a_end) && !p_bip->b_in_use;
+} /* End of bipbuffer_is_empty() */
+
+/*!
+ * @brief Discards all data and any pending reservation.
+ * @param[in,out] p_bip Pointer to the bip buffer.
+ * @return true If the buffer was cleared.
+ * @return false If p_bip is NULL.
+ * @note Time complexity: O(1)
+ */
+bool bipbuffer_clear(bipbuffer_t *p_bip)
+{
+    if (NULL == p_bip)
+    {
+        return false;
+    }
+
+    p_bip->a_start = 0;
+    p_bip->a_end = 0;
+    p_bip->b_end = 0;
+    p_bip->res_start = 0;
+    p_bip->res_size = 0;
+    p_bip->b_in_use = false;
+
+    return true;
+} /* End of bipbuffer_clear() */
+
+/*!
+ * @brief Destroys a bip buffer and releases all associated resources.
+ * @param[in] p_bip Pointer to the bip buffer.
+ * @note Time complexity: O(1)
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void bipbuffer_destroy(bipbuffer_t *p_bip)
+{
+    if (NULL == p_bip)
+    {
+        return;
+    }
+
+    free(p_bip->p_buf);
+    free(p_bip);
+} /* End of bipbuffer_destroy() */
+
+/*** End of file: bipbuffer.c */
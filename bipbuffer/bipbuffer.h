@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * 
+ * @file    bipbuffer.h
+ * @brief   Public APIs for a bipartite (bip) buffer.
+ * @details This module provides an opaque circular byte buffer that always
+ *          hands out contiguous memory. A writer reserves a region of the
+ *          exact size it needs (the buffer wraps early rather than split the
+ *          region), fills it in place and commits it; a reader obtains the
+ *          oldest committed data as one contiguous block. Encoders and
+ *          DMA-like writers therefore never need a staging copy.
+ *          Users must interact with the buffer only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The internal data structures are opaque to users to prevent
+ *          accidental violation of bip buffer invariants.
+ * 
+ ******************************************************************************/
+
+#ifndef BIPBUFFER_H
+#define BIPBUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct bipbuffer_t bipbuffer_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+bipbuffer_t* bipbuffer_create(uint32_t capacity);
+uint8_t* bipbuffer_reserve(bipbuffer_t *p_bip, uint32_t size);
+bool bipbuffer_commit(bipbuffer_t *p_bip, uint32_t size);
+const uint8_t* bipbuffer_peek_block(const bipbuffer_t *p_bip,
+                                    uint32_t *p_size);
+bool bipbuffer_consume(bipbuffer_t *p_bip, uint32_t size);
+uint32_t bipbuffer_data_count(const bipbuffer_t *p_bip);
+bool bipbuffer_is_empty(const bipbuffer_t *p_bip);
+bool bipbuffer_clear(bipbuffer_t *p_bip);
+void bipbuffer_destroy(bipbuffer_t *p_bip);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIPBUFFER_H */
+
+/*** End of file: bipbuffer.h */
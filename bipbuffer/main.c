@@ -0,0 +1,81 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the bip buffer module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "bipbuffer.h"
+
+#define BUFFER_SIZE (16)
+
+static void encode(bipbuffer_t *p_bip, const char *p_record)
+{
+    uint32_t len = (uint32_t)strlen(p_record);
+    uint8_t *p_dst = bipbuffer_reserve(p_bip, len);
+
+    if (NULL == p_dst)
+    {
+        printf("no room for \"%s\"\n", p_record);
+        return;
+    }
+
+    /* Encode straight into the buffer: no staging copy needed. */
+    memcpy(p_dst, p_record, len);
+    bipbuffer_commit(p_bip, len);
+}
+
+static void decode(bipbuffer_t *p_bip, uint32_t len)
+{
+    uint32_t size;
+    const uint8_t *p_src = bipbuffer_peek_block(p_bip, &size);
+
+    if (NULL == p_src)
+    {
+        printf("(none)\n");
+        return;
+    }
+
+    if (len > size)
+    {
+        len = size;
+    }
+
+    printf("%.*s\n", (int)len, (const char *)p_src);
+    bipbuffer_consume(p_bip, len);
+}
+
+int main(int argc, char *argv[])
+{
+    bipbuffer_t *p_bip = bipbuffer_create(BUFFER_SIZE);
+
+    encode(p_bip, "alpha");         /* [0, 5) */
+    encode(p_bip, "bravo");         /* [5, 10) */
+    encode(p_bip, "kilo");          /* [10, 14) */
+    decode(p_bip, 5);               /* alpha */
+    decode(p_bip, 5);               /* bravo */
+    encode(p_bip, "charlie");       /* Only 2 bytes after A: wraps to [0, 7). */
+    printf("%u\n", bipbuffer_data_count(p_bip)); /* 11 */
+    encode(p_bip, "delta");         /* no room for "delta" */
+    decode(p_bip, 4);               /* kilo */
+    decode(p_bip, 7);               /* charlie */
+    decode(p_bip, 7);               /* (none) */
+    printf("%d\n", bipbuffer_is_empty(p_bip)); /* 1 */
+
+    /* Reserve generously, then commit only what was written. */
+    uint8_t *p_dst = bipbuffer_reserve(p_bip, BUFFER_SIZE);
+    memcpy(p_dst, "echo", 4);
+    bipbuffer_commit(p_bip, 4);
+    decode(p_bip, 4);               /* echo */
+    encode(p_bip, "a record too long to fit"); /* no room */
+
+    bipbuffer_destroy(p_bip);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
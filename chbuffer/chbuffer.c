@@ -0,0 +1,579 @@
+/*******************************************************************************
+ *
+ * @file    chbuffer.c
+ * @brief   Implementation of a chained byte buffer.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definitions of chbuffer_t and chbuffer_seg_t are intentionally
+ *          kept private to this source file to enforce encapsulation. Users of
+ *          this module interact with the buffer only through the public API
+ *          and cannot access or modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "chbuffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Segment of a chained buffer, followed by segment_size data bytes.
+ * @note Bytes [rpos, wpos) hold unread data.
+ */
+typedef struct chbuffer_seg_t
+{
+    struct chbuffer_seg_t *p_next;
+    uint32_t rpos;
+    uint32_t wpos;
+    uint8_t data[];
+} chbuffer_seg_t;
+
+/*!
+ * @brief Structure representing a chained buffer.
+ * @note This structure is opaque to users of the API. Every segment before
+ * p_wseg is full, and every segment after it is empty, so the data is
+ * contiguous in chain order and all free space lies from p_wseg to the tail.
+ * p_wseg is NULL when the chain is empty or every segment is full.
+ */
+struct chbuffer_t
+{
+    chbuffer_seg_t *p_head;     /* Data is consumed here. */
+    chbuffer_seg_t *p_tail;     /* Segments are appended here. */
+    chbuffer_seg_t *p_wseg;     /* First segment with free space. */
+    uint32_t segment_size;
+    uint32_t data_count;
+    uint32_t seg_count;
+    chbuffer_seg_t *p_free;     /* Released segments, kept for reuse. */
+    uint32_t free_count;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint64_t chbuffer_space(const chbuffer_t *p_chb);
+static bool chbuffer_ensure_space(chbuffer_t *p_chb, uint32_t size);
+static void chbuffer_advance(chbuffer_t *p_chb, const uint8_t *p_data,
+                             uint32_t size);
+static void chbuffer_seg_release(chbuffer_t *p_chb, chbuffer_seg_t *p_seg);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes an empty chained buffer.
+ * @param[in] segment_size Number of data bytes in each segment.
+ * @return Pointer to the created buffer, or NULL if segment_size is 0 or
+ * memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note No segment is allocated until data is added.
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling chbuffer_destroy().
+ */
+chbuffer_t* chbuffer_create(uint32_t segment_size)
+{
+    if (0 == segment_size)
+    {
+        return NULL;
+    }
+
+    chbuffer_t *p_chb = calloc(1, sizeof(chbuffer_t));
+    if (NULL == p_chb)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_chb->segment_size = segment_size;
+
+    return p_chb;
+} /* End of chbuffer_create() */
+
+/*!
+ * @brief Copies data to the tail of the buffer.
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[in] p_data Pointer to the data to append.
+ * @param[in] size Number of bytes to append.
+ * @return true If all bytes were appended, or size is 0.
+ * @return false If p_chb or p_data is NULL, the data count would exceed
+ * UINT32_MAX, or memory allocation fails. Nothing is appended in that case.
+ * @note Time complexity: O(size)
+ * @note Segments are allocated before any byte is copied, so a failure leaves
+ * the data unchanged.
+ */
+bool chbuffer_append(chbuffer_t *p_chb, const uint8_t *p_data, uint32_t size)
+{
+    if ((NULL == p_chb) || (NULL == p_data))
+    {
+        return false;
+    }
+
+    if (size > (UINT32_MAX - p_chb->data_count))
+    {
+        return false;
+    }
+
+    if (!chbuffer_ensure_space(p_chb, size))
+    {
+        /* Memory allocation failed. */
+        return false;
+    }
+
+    chbuffer_advance(p_chb, p_data, size);
+
+    return true;
+} /* End of chbuffer_append() */
+
+/*!
+ * @brief Copies data out of the head of the buffer and consumes it.
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[out] p_dst Pointer to the destination.
+ * @param[in] size Capacity of p_dst in bytes.
+ * @return Number of bytes read, at most size. Returns 0 if p_chb or p_dst is
+ * NULL.
+ * @note Time complexity: O(size)
+ */
+uint32_t chbuffer_read(chbuffer_t *p_chb, uint8_t *p_dst, uint32_t size)
+{
+    if ((NULL == p_chb) || (NULL == p_dst))
+    {
+        return 0;
+    }
+
+    if (size > p_chb->data_count)
+    {
+        size = p_chb->data_count;
+    }
+
+    uint32_t copied = 0;
+    for (const chbuffer_seg_t *p_seg = p_chb->p_head; copied < size;
+         p_seg = p_seg->p_next)
+    {
+        uint32_t n = p_seg->wpos - p_seg->rpos;
+        if (n > (size - copied))
+        {
+            n = size - copied;
+        }
+
+        memcpy(&p_dst[copied], &p_seg->data[p_seg->rpos], n);
+        copied += n;
+    }
+
+    (void)chbuffer_consume(p_chb, size);
+
+    return size;
+} /* End of chbuffer_read() */
+
+/*!
+ * @brief Discards bytes from the head of the buffer.
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[in] size Number of bytes to discard.
+ * @return true If the bytes were discarded.
+ * @return false If p_chb is NULL or size exceeds the data count.
+ * @note Time complexity: O(s), where s is the number of segments spanned.
+ * @note Typically called with the number of bytes a writev() of the iovecs
+ * from chbuffer_peek_iov() has sent. Segments fully consumed are recycled.
+ */
+bool chbuffer_consume(chbuffer_t *p_chb, uint32_t size)
+{
+    if (NULL == p_chb)
+    {
+        return false;
+    }
+
+    if (size > p_chb->data_count)
+    {
+        return false;
+    }
+
+    p_chb->data_count -= size;
+
+    while (size > 0)
+    {
+        chbuffer_seg_t *p_seg = p_chb->p_head;
+        uint32_t n = p_seg->wpos - p_seg->rpos;
+        if (n > size)
+        {
+            n = size;
+        }
+        p_seg->rpos += n;
+        size -= n;
+
+        if (p_chb->segment_size == p_seg->rpos)
+        {
+            /* Written and read in full: unlink, like slist_remove_head(). */
+            p_chb->p_head = p_seg->p_next;
+            if (NULL == p_chb->p_head)
+            {
+                p_chb->p_tail = NULL;
+            }
+            p_chb->seg_count--;
+            chbuffer_seg_release(p_chb, p_seg);
+        }
+    }
+
+    return true;
+} /* End of chbuffer_consume() */
+
+/*!
+ * @brief Describes the stored data as an iovec array, e.g., for writev().
+ * @param[in] p_chb Pointer to the chained buffer.
+ * @param[out] p_iov Pointer to the array that receives the descriptors.
+ * @param[in] iov_max Number of elements in p_iov.
+ * @return Number of descriptors filled in, 0 if the buffer is empty, or if
+ * p_chb or p_iov is NULL.
+ * @note Time complexity: O(iov_max)
+ * @note The descriptors cover the oldest data in order, one per segment. They
+ * stay valid until the data is consumed or the buffer is cleared.
+ */
+uint32_t chbuffer_peek_iov(const chbuffer_t *p_chb, struct iovec *p_iov,
+                           uint32_t iov_max)
+{
+    if ((NULL == p_chb) || (NULL == p_iov))
+    {
+        return 0;
+    }
+
+    uint32_t count = 0;
+    for (const chbuffer_seg_t *p_seg = p_chb->p_head;
+         (NULL != p_seg) && (count < iov_max); p_seg = p_seg->p_next)
+    {
+        if (p_seg->wpos > p_seg->rpos)
+        {
+            p_iov[count].iov_base = (void *)&p_seg->data[p_seg->rpos];
+            p_iov[count].iov_len = p_seg->wpos - p_seg->rpos;
+            count++;
+        }
+
+        if (p_seg == p_chb->p_wseg)
+        {
+            /* No data beyond the first segment with free space. */
+            break;
+        }
+    }
+
+    return count;
+} /* End of chbuffer_peek_iov() */
+
+/*!
+ * @brief Makes room for incoming data and describes it as an iovec array,
+ * e.g., for readv().
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[in] size Number of bytes of room requested.
+ * @param[out] p_iov Pointer to the array that receives the descriptors.
+ * @param[in] iov_max Number of elements in p_iov.
+ * @return Number of descriptors filled in, or 0 if p_chb or p_iov is NULL,
+ * size or iov_max is 0, or memory allocation fails.
+ * @note Time complexity: O(s), where s is the number of segments spanned.
+ * @note The descriptors cover exactly size bytes, or less if iov_max is too
+ * small. Bytes written there become data only when passed to
+ * chbuffer_commit(); they must be committed before the buffer is otherwise
+ * written to or cleared.
+ */
+uint32_t chbuffer_reserve_iov(chbuffer_t *p_chb, uint32_t size,
+                              struct iovec *p_iov, uint32_t iov_max)
+{
+    if ((NULL == p_chb) || (NULL == p_iov) || (0 == size) || (0 == iov_max))
+    {
+        return 0;
+    }
+
+    if (!chbuffer_ensure_space(p_chb, size))
+    {
+        /* Memory allocation failed. */
+        return 0;
+    }
+
+    uint32_t count = 0;
+    for (chbuffer_seg_t *p_seg = p_chb->p_wseg; (size > 0) && (count < iov_max);
+         p_seg = p_seg->p_next)
+    {
+        uint32_t n = p_chb->segment_size - p_seg->wpos;
+        if (n > size)
+        {
+            n = size;
+        }
+
+        p_iov[count].iov_base = &p_seg->data[p_seg->wpos];
+        p_iov[count].iov_len = n;
+        size -= n;
+        count++;
+    }
+
+    return count;
+} /* End of chbuffer_reserve_iov() */
+
+/*!
+ * @brief Publishes bytes written into the room from chbuffer_reserve_iov().
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[in] size Number of bytes actually written, e.g., the result of
+ * readv(). 0 is allowed.
+ * @return true If the bytes were committed.
+ * @return false If p_chb is NULL, size exceeds the free space at the tail, or
+ * the data count would exceed UINT32_MAX.
+ * @note Time complexity: O(s), where s is the number of segments spanned.
+ */
+bool chbuffer_commit(chbuffer_t *p_chb, uint32_t size)
+{
+    if (NULL == p_chb)
+    {
+        return false;
+    }
+
+    if ((size > chbuffer_space(p_chb))
+        || (size > (UINT32_MAX - p_chb->data_count)))
+    {
+        return false;
+    }
+
+    chbuffer_advance(p_chb, NULL, size);
+
+    return true;
+} /* End of chbuffer_commit() */
+
+/*!
+ * @brief Counts the number of bytes stored in the buffer.
+ * @param[in] p_chb Pointer to the chained buffer.
+ * @return Number of bytes. Returns 0 if p_chb is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t chbuffer_data_count(const chbuffer_t *p_chb)
+{
+    if (NULL == p_chb)
+    {
+        return 0;
+    }
+
+    return p_chb->data_count;
+} /* End of chbuffer_data_count() */
+
+/*!
+ * @brief Counts the segments linked into the buffer.
+ * @param[in] p_chb Pointer to the chained buffer.
+ * @return Number of segments, including empty ones at the tail and excluding
+ * recycled ones. Returns 0 if p_chb is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t chbuffer_segment_count(const chbuffer_t *p_chb)
+{
+    if (NULL == p_chb)
+    {
+        return 0;
+    }
+
+    return p_chb->seg_count;
+} /* End of chbuffer_segment_count() */
+
+/*!
+ * @brief Checks whether the buffer holds no data.
+ * @param[in] p_chb Pointer to the chained buffer.
+ * @return true If the buffer is empty.
+ * @return false If the buffer contains data, or if p_chb is NULL.
+ * @note Time complexity: O(1)
+ */
+bool chbuffer_is_empty(const chbuffer_t *p_chb)
+{
+    if (NULL == p_chb)
+    {
+        return false;
+    }
+
+    return (0 == p_chb->data_count);
+} /* End of chbuffer_is_empty() */
+
+/*!
+ * @brief Discards all data and unlinks every segment.
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @return true If the buffer was cleared.
+ * @return false If p_chb is NULL.
+ * @note Time complexity: O(s), where s is the number of segments.
+ * @note Up to CHBUFFER_FREE_MAX segments are kept for reuse; the rest are
+ * freed.
+ */
+bool chbuffer_clear(chbuffer_t *p_chb)
+{
+    if (NULL == p_chb)
+    {
+        return false;
+    }
+
+    chbuffer_seg_t *p_seg = p_chb->p_head;
+    while (NULL != p_seg)
+    {
+        chbuffer_seg_t *p_next = p_seg->p_next;
+        chbuffer_seg_release(p_chb, p_seg);
+        p_seg = p_next;
+    }
+
+    p_chb->p_head = NULL;
+    p_chb->p_tail = NULL;
+    p_chb->p_wseg = NULL;
+    p_chb->data_count = 0;
+    p_chb->seg_count = 0;
+
+    return true;
+} /* End of chbuffer_clear() */
+
+/*!
+ * @brief Destroys a chained buffer and releases all associated resources.
+ * @param[in] p_chb Pointer to the chained buffer.
+ * @note Time complexity: O(s), where s is the number of segments.
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void chbuffer_destroy(chbuffer_t *p_chb)
+{
+    if (NULL == p_chb)
+    {
+        return;
+    }
+
+    (void)chbuffer_clear(p_chb);
+
+    chbuffer_seg_t *p_seg = p_chb->p_free;
+    while (NULL != p_seg)
+    {
+        chbuffer_seg_t *p_next = p_seg->p_next;
+        free(p_seg);
+        p_seg = p_next;
+    }
+
+    free(p_chb);
+} /* End of chbuffer_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Computes the free space from p_wseg to the tail.
+ * @param[in] p_chb Pointer to the chained buffer.
+ * @return Number of free bytes.
+ * @note Time complexity: O(s), where s is the number of segments with free
+ * space; usually 1.
+ */
+static uint64_t chbuffer_space(const chbuffer_t *p_chb)
+{
+    uint64_t space = 0;
+
+    for (const chbuffer_seg_t *p_seg = p_chb->p_wseg; NULL != p_seg;
+         p_seg = p_seg->p_next)
+    {
+        space += p_chb->segment_size - p_seg->wpos;
+    }
+
+    return space;
+} /* End of chbuffer_space() */
+
+/*!
+ * @brief Links empty segments at the tail until there is room for size bytes.
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[in] size Number of bytes of room needed.
+ * @return true If there is enough room.
+ * @return false If memory allocation fails. Segments already linked are kept
+ * as free space.
+ * @note Time complexity: O(size / segment_size)
+ */
+static bool chbuffer_ensure_space(chbuffer_t *p_chb, uint32_t size)
+{
+    uint64_t space = chbuffer_space(p_chb);
+
+    while (space < size)
+    {
+        chbuffer_seg_t *p_seg = p_chb->p_free;
+        if (NULL != p_seg)
+        {
+            p_chb->p_free = p_seg->p_next;
+            p_chb->free_count--;
+        }
+        else
+        {
+            p_seg = malloc(sizeof(chbuffer_seg_t) + p_chb->segment_size);
+            if (NULL == p_seg)
+            {
+                /* Memory allocation failed. */
+                return false;
+            }
+        }
+
+        p_seg->p_next = NULL;
+        p_seg->rpos = 0;
+        p_seg->wpos = 0;
+
+        /* Link at the tail, like slist_add_to_tail(). */
+        if (NULL == p_chb->p_tail)
+        {
+            p_chb->p_head = p_seg;
+        }
+        else
+        {
+            p_chb->p_tail->p_next = p_seg;
+        }
+        p_chb->p_tail = p_seg;
+        p_chb->seg_count++;
+
+        if (NULL == p_chb->p_wseg)
+        {
+            p_chb->p_wseg = p_seg;
+        }
+        space += p_chb->segment_size;
+    }
+
+    return true;
+} /* End of chbuffer_ensure_space() */
+
+/*!
+ * @brief Advances the write position over free space, optionally copying
+ * data into it.
+ * @param[in,out] p_chb Pointer to the chained buffer, with at least size
+ * bytes of free space.
+ * @param[in] p_data Data to copy, or NULL if the bytes are already in place.
+ * @param[in] size Number of bytes.
+ * @note Time complexity: O(size) with p_data, otherwise O(s), where s is the
+ * number of segments spanned.
+ */
+static void chbuffer_advance(chbuffer_t *p_chb, const uint8_t *p_data,
+                             uint32_t size)
+{
+    p_chb->data_count += size;
+
+    while (size > 0)
+    {
+        chbuffer_seg_t *p_seg = p_chb->p_wseg;
+        uint32_t n = p_chb->segment_size - p_seg->wpos;
+        if (n > size)
+        {
+            n = size;
+        }
+
+        if (NULL != p_data)
+        {
+            memcpy(&p_seg->data[p_seg->wpos], p_data, n);
+            p_data += n;
+        }
+        p_seg->wpos += n;
+        size -= n;
+
+        if (p_chb->segment_size == p_seg->wpos)
+        {
+            p_chb->p_wseg = p_seg->p_next;
+        }
+    }
+} /* End of chbuffer_advance() */
+
+/*!
+ * @brief Recycles an unlinked segment.
+ * @param[in,out] p_chb Pointer to the chained buffer.
+ * @param[in] p_seg Segment no longer in the chain.
+ * @note Time complexity: O(1)
+ */
+static void chbuffer_seg_release(chbuffer_t *p_chb, chbuffer_seg_t *p_seg)
+{
+    if (p_chb->free_count >= CHBUFFER_FREE_MAX)
+    {
+        free(p_seg);
+        return;
+    }
+
+    p_seg->p_next = p_chb->p_free;
+    p_chb->p_free = p_seg;
+    p_chb->free_count++;
+} /* End of chbuffer_seg_release() */
+
+/*** End of file: chbuffer.c */
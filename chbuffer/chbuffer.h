@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * @file    chbuffer.h
+ * @brief   Public APIs for a chained byte buffer.
+ * @details This module provides an opaque, unbounded byte buffer made of
+ *          fixed-size segments linked head to tail like slist_t. Data is
+ *          appended at the tail and consumed from the head, so growing the
+ *          buffer never moves bytes already stored. The stored data can be
+ *          exported as an iovec array for writev(), and free space at the tail
+ *          as an iovec array for readv() followed by chbuffer_commit().
+ *          Segments released by consumption are recycled through a small free
+ *          list before any new segment is allocated.
+ *          Users must interact with the buffer only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The internal data structures are opaque to users to prevent
+ *          accidental violation of chained buffer invariants.
+ *
+ ******************************************************************************/
+
+#ifndef CHBUFFER_H
+#define CHBUFFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+#define CHBUFFER_FREE_MAX   (16U)   /* Released segments kept for reuse. */
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct chbuffer_t chbuffer_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+chbuffer_t* chbuffer_create(uint32_t segment_size);
+bool chbuffer_append(chbuffer_t *p_chb, const uint8_t *p_data, uint32_t size);
+uint32_t chbuffer_read(chbuffer_t *p_chb, uint8_t *p_dst, uint32_t size);
+bool chbuffer_consume(chbuffer_t *p_chb, uint32_t size);
+uint32_t chbuffer_peek_iov(const chbuffer_t *p_chb, struct iovec *p_iov,
+                           uint32_t iov_max);
+uint32_t chbuffer_reserve_iov(chbuffer_t *p_chb, uint32_t size,
+                              struct iovec *p_iov, uint32_t iov_max);
+bool chbuffer_commit(chbuffer_t *p_chb, uint32_t size);
+uint32_t chbuffer_data_count(const chbuffer_t *p_chb);
+uint32_t chbuffer_segment_count(const chbuffer_t *p_chb);
+bool chbuffer_is_empty(const chbuffer_t *p_chb);
+bool chbuffer_clear(chbuffer_t *p_chb);
+void chbuffer_destroy(chbuffer_t *p_chb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHBUFFER_H */
+
+/*** End of file: chbuffer.h */
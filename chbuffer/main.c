@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the chained buffer module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "chbuffer.h"
+
+#define SEGMENT_SIZE    (8)
+#define IOV_MAX_COUNT   (8)
+
+int main(int argc, char *argv[])
+{
+    struct iovec iov[IOV_MAX_COUNT];
+    uint8_t out[32];
+    int fds[2];
+
+    chbuffer_t *p_chb = chbuffer_create(SEGMENT_SIZE);
+    printf("%d\n", chbuffer_is_empty(p_chb)); /* 1 */
+
+    /* Appending links new segments; stored bytes never move. */
+    const char *p_head = "HTTP/1.1 200 OK\r\n";
+    const char *p_body = "hello, chains";
+    chbuffer_append(p_chb, (const uint8_t *)p_head, (uint32_t)strlen(p_head));
+    chbuffer_append(p_chb, (const uint8_t *)p_body, (uint32_t)strlen(p_body));
+    printf("%u %u\n", chbuffer_data_count(p_chb),
+           chbuffer_segment_count(p_chb)); /* 30 4 */
+
+    /* Gather the segments into one writev() without copying. */
+    uint32_t count = chbuffer_peek_iov(p_chb, iov, IOV_MAX_COUNT);
+    printf("%u\n", count); /* 4 */
+    chbuffer_consume(p_chb, 17);
+    count = chbuffer_peek_iov(p_chb, iov, IOV_MAX_COUNT);
+    fflush(stdout);
+    writev(STDOUT_FILENO, iov, (int)count);
+    printf("\n"); /* hello, chains */
+
+    /* The fully consumed segments were unlinked. */
+    printf("%u %u\n", chbuffer_data_count(p_chb),
+           chbuffer_segment_count(p_chb)); /* 13 2 */
+
+    /* Scatter incoming bytes straight into the tail with readv(). */
+    pipe(fds);
+    write(fds[1], " and iovecs", 11);
+    count = chbuffer_reserve_iov(p_chb, 16, iov, IOV_MAX_COUNT);
+    ssize_t n = readv(fds[0], iov, (int)count);
+    chbuffer_commit(p_chb, (uint32_t)n);
+    close(fds[0]);
+    close(fds[1]);
+    printf("%u\n", chbuffer_data_count(p_chb)); /* 24 */
+
+    uint32_t len = chbuffer_read(p_chb, out, sizeof(out));
+    printf("%.*s\n", (int)len, (const char *)out); /* hello, chains and iovecs */
+    printf("%d\n", chbuffer_is_empty(p_chb)); /* 1 */
+    printf("%d\n", chbuffer_consume(p_chb, 1)); /* 0 */
+
+    chbuffer_destroy(p_chb);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
@@ -0,0 +1,468 @@
+/*******************************************************************************
+ *
+ * @file    cqueue.c
+ * @brief   Implementation of a conflating keyed queue.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definitions of cqueue_t and cqueue_slot_t are intentionally
+ *          kept private to this source file to enforce encapsulation. Users of
+ *          this module interact with the queue only through the public API and
+ *          cannot access or modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "cqueue.h"
+#include <stdlib.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define CQUEUE_HASH_MULT    (0x9E3779B1U)   /* 2^32 / golden ratio. */
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Slot of the hash table holding a pending key and its latest value.
+ */
+typedef struct
+{
+    uint32_t key;
+    int32_t value;
+    bool b_used;
+} cqueue_slot_t;
+
+/*!
+ * @brief Structure representing a conflating queue.
+ * @note This structure is opaque to users of the API. p_keys is a ring of
+ * capacity keys in arrival order, indexed like rbuffer: ridx is the oldest key
+ * and widx the slot after the newest, with count telling a full ring from an
+ * empty one. Every key in the ring has exactly one slot in p_slots, a linear
+ * probing table of a power-of-two size at least twice the capacity, so probe
+ * sequences stay short.
+ */
+struct cqueue_t
+{
+    uint32_t *p_keys;
+    uint32_t capacity;
+    uint32_t ridx;   /* Index of the oldest key. */
+    uint32_t widx;   /* Index one past the newest key. */
+    uint32_t count;
+    cqueue_slot_t *p_slots;
+    uint32_t mask;   /* Table size - 1. */
+    uint32_t shift;  /* 32 - log2(table size). */
+    uint64_t conflated;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint32_t cqueue_home(const cqueue_t *p_cq, uint32_t key);
+static uint32_t cqueue_find(const cqueue_t *p_cq, uint32_t key);
+static void cqueue_remove_slot(cqueue_t *p_cq, uint32_t idx);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes a conflating queue.
+ * @param[in] capacity Maximum number of distinct keys pending at once.
+ * @return Pointer to the created queue, or NULL if capacity is less than 1 or
+ * greater than 2^30, or if any memory allocation fails.
+ * @note Time complexity: O(capacity)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling cqueue_destroy().
+ */
+cqueue_t* cqueue_create(uint32_t capacity)
+{
+    if ((capacity < 1) || (capacity > (1U << 30)))
+    {
+        return NULL;
+    }
+
+    cqueue_t *p_cq = malloc(sizeof(cqueue_t));
+    if (NULL == p_cq)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    /* Keep the table at most half full. */
+    uint32_t bits = 1;
+    while ((1U << bits) < (2U * capacity))
+    {
+        bits++;
+    }
+
+    p_cq->p_keys = malloc(capacity * sizeof(uint32_t));
+    p_cq->p_slots = calloc(1U << bits, sizeof(cqueue_slot_t));
+    if ((NULL == p_cq->p_keys) || (NULL == p_cq->p_slots))
+    {
+        free(p_cq->p_keys);
+        free(p_cq->p_slots);
+        free(p_cq);
+        return NULL;
+    }
+
+    p_cq->capacity = capacity;
+    p_cq->ridx = 0;
+    p_cq->widx = 0;
+    p_cq->count = 0;
+    p_cq->mask = (1U << bits) - 1U;
+    p_cq->shift = 32U - bits;
+    p_cq->conflated = 0;
+
+    return p_cq;
+} /* End of cqueue_create() */
+
+/*!
+ * @brief Queues an update, or replaces the value of a pending key.
+ * @param[in,out] p_cq Pointer to the conflating queue.
+ * @param[in] key Key of the update.
+ * @param[in] value Latest value of the key.
+ * @return true If the update was queued or conflated.
+ * @return false If p_cq is NULL, or the key is not pending and capacity
+ * distinct keys are already pending.
+ * @note Time complexity: O(1) expected.
+ * @note A conflated update keeps the position of the pending key, so a key
+ * that is updated continuously is not starved by later keys.
+ */
+bool cqueue_put(cqueue_t *p_cq, uint32_t key, int32_t value)
+{
+    if (NULL == p_cq)
+    {
+        return false;
+    }
+
+    uint32_t idx = cqueue_find(p_cq, key);
+    cqueue_slot_t *p_slot = &p_cq->p_slots[idx];
+
+    if (p_slot->b_used)
+    {
+        /* Already pending: replace the value in place. */
+        p_slot->value = value;
+        p_cq->conflated++;
+        return true;
+    }
+
+    if (p_cq->count == p_cq->capacity)
+    {
+        /* Queue full of distinct keys. */
+        return false;
+    }
+
+    p_slot->key = key;
+    p_slot->value = value;
+    p_slot->b_used = true;
+
+    p_cq->p_keys[p_cq->widx] = key;
+    p_cq->widx++;
+    if (p_cq->widx >= p_cq->capacity)
+    {
+        p_cq->widx = 0;
+    }
+    p_cq->count++;
+
+    return true;
+} /* End of cqueue_put() */
+
+/*!
+ * @brief Removes the oldest pending key and its latest value.
+ * @param[in,out] p_cq Pointer to the conflating queue.
+ * @param[out] p_key Pointer to variable that receives the key.
+ * @param[out] p_value Pointer to variable that receives the value.
+ * @return true If an update was removed.
+ * @return false If the queue is empty, or any pointer is NULL.
+ * @note Time complexity: O(1) expected.
+ * @note The slot is deleted by shifting later entries of its probe sequence
+ * back, so the table never accumulates tombstones.
+ */
+bool cqueue_get(cqueue_t *p_cq, uint32_t *p_key, int32_t *p_value)
+{
+    if (NULL == p_cq || NULL == p_key || NULL == p_value)
+    {
+        return false;
+    }
+
+    if (0 == p_cq->count)
+    {
+        return false;
+    }
+
+    uint32_t key = p_cq->p_keys[p_cq->ridx];
+    p_cq->ridx++;
+    if (p_cq->ridx >= p_cq->capacity)
+    {
+        p_cq->ridx = 0;
+    }
+    p_cq->count--;
+
+    uint32_t idx = cqueue_find(p_cq, key);
+    *p_key = key;
+    *p_value = p_cq->p_slots[idx].value;
+    cqueue_remove_slot(p_cq, idx);
+
+    return true;
+} /* End of cqueue_get() */
+
+/*!
+ * @brief Returns the oldest pending key and its latest value without removing
+ * them.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @param[out] p_key Pointer to variable that receives the key.
+ * @param[out] p_value Pointer to variable that receives the value.
+ * @return true If the queue is not empty.
+ * @return false If the queue is empty, or any pointer is NULL.
+ * @note Time complexity: O(1) expected.
+ */
+bool cqueue_peek(const cqueue_t *p_cq, uint32_t *p_key, int32_t *p_value)
+{
+    if (NULL == p_cq || NULL == p_key || NULL == p_value)
+    {
+        return false;
+    }
+
+    if (0 == p_cq->count)
+    {
+        return false;
+    }
+
+    uint32_t key = p_cq->p_keys[p_cq->ridx];
+    *p_key = key;
+    *p_value = p_cq->p_slots[cqueue_find(p_cq, key)].value;
+
+    return true;
+} /* End of cqueue_peek() */
+
+/*!
+ * @brief Reads the pending value of a key.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @param[in] key Key to look up.
+ * @param[out] p_value Pointer to variable that receives the value.
+ * @return true If the key is pending.
+ * @return false If the key is not pending, or p_cq or p_value is NULL.
+ * @note Time complexity: O(1) expected.
+ */
+bool cqueue_lookup(const cqueue_t *p_cq, uint32_t key, int32_t *p_value)
+{
+    if (NULL == p_cq || NULL == p_value)
+    {
+        return false;
+    }
+
+    const cqueue_slot_t *p_slot = &p_cq->p_slots[cqueue_find(p_cq, key)];
+    if (!p_slot->b_used)
+    {
+        return false;
+    }
+
+    *p_value = p_slot->value;
+
+    return true;
+} /* End of cqueue_lookup() */
+
+/*!
+ * @brief Counts the pending keys.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @return Number of pending keys. Returns 0 if p_cq is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t cqueue_size(const cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return 0;
+    }
+
+    return p_cq->count;
+} /* End of cqueue_size() */
+
+/*!
+ * @brief Returns the maximum number of pending keys.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @return Capacity given to cqueue_create(). Returns 0 if p_cq is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t cqueue_capacity(const cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return 0;
+    }
+
+    return p_cq->capacity;
+} /* End of cqueue_capacity() */
+
+/*!
+ * @brief Counts the updates that replaced the value of a pending key.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @return Number of conflated updates since creation or the last clear, i.e.,
+ * the number of items the consumer did not have to process. Returns 0 if p_cq
+ * is NULL.
+ * @note Time complexity: O(1)
+ */
+uint64_t cqueue_conflated_count(const cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return 0;
+    }
+
+    return p_cq->conflated;
+} /* End of cqueue_conflated_count() */
+
+/*!
+ * @brief Checks whether no key is pending.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @return true If the queue is empty.
+ * @return false If the queue contains keys, or if p_cq is NULL.
+ * @note Time complexity: O(1)
+ */
+bool cqueue_is_empty(const cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return false;
+    }
+
+    return (0 == p_cq->count);
+} /* End of cqueue_is_empty() */
+
+/*!
+ * @brief Checks whether capacity distinct keys are pending.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @return true If the queue is full. Updates of pending keys still succeed.
+ * @return false If the queue is not full, or if p_cq is NULL.
+ * @note Time complexity: O(1)
+ */
+bool cqueue_is_full(const cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return false;
+    }
+
+    return (p_cq->count == p_cq->capacity);
+} /* End of cqueue_is_full() */
+
+/*!
+ * @brief Discards all pending keys and resets the conflated count.
+ * @param[in,out] p_cq Pointer to the conflating queue.
+ * @return true If the queue was cleared.
+ * @return false If p_cq is NULL.
+ * @note Time complexity: O(n), where n is the number of pending keys.
+ */
+bool cqueue_clear(cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return false;
+    }
+
+    /* Only the slots of pending keys are in use. */
+    for (uint32_t i = 0; i < p_cq->count; i++)
+    {
+        uint32_t ring_idx = p_cq->ridx + i;
+        if (ring_idx >= p_cq->capacity)
+        {
+            ring_idx -= p_cq->capacity;
+        }
+        cqueue_remove_slot(p_cq, cqueue_find(p_cq, p_cq->p_keys[ring_idx]));
+    }
+
+    p_cq->ridx = 0;
+    p_cq->widx = 0;
+    p_cq->count = 0;
+    p_cq->conflated = 0;
+
+    return true;
+} /* End of cqueue_clear() */
+
+/*!
+ * @brief Destroys a conflating queue and releases all associated resources.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @note Time complexity: O(1)
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void cqueue_destroy(cqueue_t *p_cq)
+{
+    if (NULL == p_cq)
+    {
+        return;
+    }
+
+    free(p_cq->p_keys);
+    free(p_cq->p_slots);
+    free(p_cq);
+} /* End of cqueue_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Computes the home slot of a key (Fibonacci hashing).
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @param[in] key Key to hash.
+ * @return Index of the first slot to probe.
+ */
+static uint32_t cqueue_home(const cqueue_t *p_cq, uint32_t key)
+{
+    /* The top bits of the product are the best mixed. A shift by 32 for a
+     * one-slot table cannot happen: the table has at least two slots. */
+    return (key * CQUEUE_HASH_MULT) >> p_cq->shift;
+} /* End of cqueue_home() */
+
+/*!
+ * @brief Finds the slot of a key, or the free slot where it would go.
+ * @param[in] p_cq Pointer to the conflating queue.
+ * @param[in] key Key to find.
+ * @return Index of the slot holding key, or of the first free slot on its
+ * probe sequence.
+ * @note Time complexity: O(1) expected; the table is never more than half
+ * full, so a free slot always exists.
+ */
+static uint32_t cqueue_find(const cqueue_t *p_cq, uint32_t key)
+{
+    uint32_t idx = cqueue_home(p_cq, key);
+
+    while (p_cq->p_slots[idx].b_used && (key != p_cq->p_slots[idx].key))
+    {
+        idx = (idx + 1U) & p_cq->mask;
+    }
+
+    return idx;
+} /* End of cqueue_find() */
+
+/*!
+ * @brief Frees a used slot with backward-shift deletion.
+ * @param[in,out] p_cq Pointer to the conflating queue.
+ * @param[in] idx Index of the slot to free.
+ * @note Time complexity: O(1) expected.
+ * @note Each later entry of the probe cluster whose home slot does not lie
+ * cyclically in (idx, j] is moved back into the hole, which keeps every key
+ * reachable from its home slot without tombstones.
+ */
+static void cqueue_remove_slot(cqueue_t *p_cq, uint32_t idx)
+{
+    uint32_t j = idx;
+
+    for (;;)
+    {
+        j = (j + 1U) & p_cq->mask;
+        if (!p_cq->p_slots[j].b_used)
+        {
+            break;
+        }
+
+        uint32_t home = cqueue_home(p_cq, p_cq->p_slots[j].key);
+
+        /* Distances from the hole and from the home slot to j. */
+        uint32_t dist_hole = (j - idx) & p_cq->mask;
+        uint32_t dist_home = (j - home) & p_cq->mask;
+        if (dist_home >= dist_hole)
+        {
+            p_cq->p_slots[idx] = p_cq->p_slots[j];
+            idx = j;
+        }
+    }
+
+    p_cq->p_slots[idx].b_used = false;
+} /* End of cqueue_remove_slot() */
+
+/*** End of file: cqueue.c */
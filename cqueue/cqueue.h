@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *
+ * @file    cqueue.h
+ * @brief   Public APIs for a conflating keyed queue.
+ * @details This module provides an opaque FIFO queue of (key, value) updates
+ *          in which each key is pending at most once. Putting a key that is
+ *          already queued replaces its value in place and keeps its position,
+ *          so only the latest value per key reaches the consumer and the queue
+ *          length is bounded by the number of distinct keys, however bursty
+ *          the producer. The keys are kept in a ring indexed like rbuffer, and
+ *          the pending values in an open-addressing hash table.
+ *          Users must interact with the queue only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The internal data structures are opaque to users to prevent
+ *          accidental violation of queue invariants.
+ *
+ ******************************************************************************/
+
+#ifndef CQUEUE_H
+#define CQUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct cqueue_t cqueue_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+cqueue_t* cqueue_create(uint32_t capacity);
+bool cqueue_put(cqueue_t *p_cq, uint32_t key, int32_t value);
+bool cqueue_get(cqueue_t *p_cq, uint32_t *p_key, int32_t *p_value);
+bool cqueue_peek(const cqueue_t *p_cq, uint32_t *p_key, int32_t *p_value);
+bool cqueue_lookup(const cqueue_t *p_cq, uint32_t key, int32_t *p_value);
+uint32_t cqueue_size(const cqueue_t *p_cq);
+uint32_t cqueue_capacity(const cqueue_t *p_cq);
+uint64_t cqueue_conflated_count(const cqueue_t *p_cq);
+bool cqueue_is_empty(const cqueue_t *p_cq);
+bool cqueue_is_full(const cqueue_t *p_cq);
+bool cqueue_clear(cqueue_t *p_cq);
+void cqueue_destroy(cqueue_t *p_cq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQUEUE_H */
+
+/*** End of file: cqueue.h */
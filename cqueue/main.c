@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the conflating queue module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "cqueue.h"
+
+#define CAPACITY (3)
+
+int main(int argc, char *argv[])
+{
+    uint32_t key;
+    int32_t value;
+
+    cqueue_t *p_cq = cqueue_create(CAPACITY);
+    printf("%d\n", cqueue_is_empty(p_cq)); /* 1 */
+
+    /* A burst of quotes for three symbols. */
+    cqueue_put(p_cq, 7, 100);
+    cqueue_put(p_cq, 3, 200);
+    cqueue_put(p_cq, 7, 101);
+    cqueue_put(p_cq, 9, 300);
+    cqueue_put(p_cq, 7, 102);
+    printf("%u\n", cqueue_size(p_cq)); /* 3 */
+    printf("%llu\n",
+           (unsigned long long)cqueue_conflated_count(p_cq)); /* 2 */
+
+    /* Full of distinct keys: a new key is refused, a pending one is not. */
+    printf("%d\n", cqueue_put(p_cq, 5, 400)); /* 0 */
+    printf("%d\n", cqueue_put(p_cq, 3, 201)); /* 1 */
+    cqueue_lookup(p_cq, 3, &value);
+    printf("%d\n", value); /* 201 */
+
+    /* Keys come out in first-arrival order with their latest values. */
+    while (cqueue_get(p_cq, &key, &value))
+    {
+        printf("%u:%d ", key, value);
+    }
+    printf("\n"); /* 7:102 3:201 9:300 */
+
+    /* A consumed key is queued again by its next update. */
+    cqueue_put(p_cq, 7, 103);
+    cqueue_peek(p_cq, &key, &value);
+    printf("%u:%d\n", key, value); /* 7:103 */
+
+    cqueue_clear(p_cq);
+    printf("%d\n", cqueue_lookup(p_cq, 7, &value)); /* 0 */
+
+    cqueue_destroy(p_cq);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
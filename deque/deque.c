@@ -0,0 +1,459 @@
+/*******************************************************************************
+ *
+ * @file    deque.c
+ * @brief   Implementation of a growable double-ended queue.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definition of deque_t is intentionally kept private to this
+ *          source file to enforce encapsulation. Users of this module interact
+ *          with the deque only through the public API and cannot access or
+ *          modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "deque.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Structure representing a double-ended queue.
+ * @note This structure is opaque to users of the API. The indices follow the
+ * ring buffer: ridx is the front element and widx the slot after the back
+ * element, and b_is_full tells a full array from an empty one.
+ */
+struct deque_t
+{
+    int32_t *p_buf;
+    uint32_t capacity;
+    uint32_t ridx;   /* Index of the front element. */
+    uint32_t widx;   /* Index one past the back element. */
+    bool b_is_full;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool deque_grow(deque_t *p_dq);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes a double-ended queue.
+ * @param[in] capacity Number of elements the deque can store before it has to
+ * grow.
+ * @return Pointer to the created deque, or NULL if capacity is less than 1 or
+ * if any memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling deque_destroy().
+ */
+deque_t* deque_create(uint32_t capacity)
+{
+    if (capacity < 1)
+    {
+        return NULL;
+    }
+
+    deque_t *p_dq = malloc(sizeof(deque_t));
+    if (NULL == p_dq)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_dq->p_buf = malloc(capacity * sizeof(int32_t));
+    if (NULL == p_dq->p_buf)
+    {
+        free(p_dq);
+        return NULL;
+    }
+    p_dq->capacity = capacity;
+    p_dq->ridx = 0;
+    p_dq->widx = 0;
+    p_dq->b_is_full = false;
+
+    return p_dq;
+} /* End of deque_create() */
+
+/*!
+ * @brief Inserts an element at the front of the deque.
+ * @param[in,out] p_dq Pointer to the deque.
+ * @param[in] data Data to insert.
+ * @return true If the element was inserted.
+ * @return false If p_dq is NULL, or if the deque is full and growing it fails.
+ * @note Time complexity: amortized O(1)
+ */
+bool deque_push_front(deque_t *p_dq, int32_t data)
+{
+    if (NULL == p_dq)
+    {
+        return false;
+    }
+
+    if (p_dq->b_is_full && !deque_grow(p_dq))
+    {
+        return false;
+    }
+
+    /* Step the read index back. */
+    if (0 == p_dq->ridx)
+    {
+        p_dq->ridx = p_dq->capacity;
+    }
+    p_dq->ridx--;
+    p_dq->p_buf[p_dq->ridx] = data;
+
+    if (p_dq->widx == p_dq->ridx)
+    {
+        p_dq->b_is_full = true;
+    }
+
+    return true;
+} /* End of deque_push_front() */
+
+/*!
+ * @brief Inserts an element at the back of the deque.
+ * @param[in,out] p_dq Pointer to the deque.
+ * @param[in] data Data to insert.
+ * @return true If the element was inserted.
+ * @return false If p_dq is NULL, or if the deque is full and growing it fails.
+ * @note Time complexity: amortized O(1)
+ */
+bool deque_push_back(deque_t *p_dq, int32_t data)
+{
+    if (NULL == p_dq)
+    {
+        return false;
+    }
+
+    if (p_dq->b_is_full && !deque_grow(p_dq))
+    {
+        return false;
+    }
+
+    p_dq->p_buf[p_dq->widx] = data;
+
+    /* Advance write index. */
+    p_dq->widx++;
+    if (p_dq->widx >= p_dq->capacity)
+    {
+        p_dq->widx = 0;
+    }
+
+    if (p_dq->widx == p_dq->ridx)
+    {
+        p_dq->b_is_full = true;
+    }
+
+    return true;
+} /* End of deque_push_back() */
+
+/*!
+ * @brief Removes the element at the front of the deque.
+ * @param[in,out] p_dq Pointer to the deque.
+ * @param[out] p_data Pointer to the variable that receives the element.
+ * @return true If an element was removed.
+ * @return false If p_dq or p_data is NULL, or the deque is empty.
+ * @note Time complexity: O(1)
+ */
+bool deque_pop_front(deque_t *p_dq, int32_t *p_data)
+{
+    if (NULL == p_dq || NULL == p_data)
+    {
+        return false;
+    }
+
+    if ((p_dq->widx == p_dq->ridx) && !p_dq->b_is_full)
+    {
+        /* Cannot pop from an empty deque. */
+        return false;
+    }
+
+    *p_data = p_dq->p_buf[p_dq->ridx];
+
+    /* Advance read index. */
+    p_dq->ridx++;
+    if (p_dq->ridx >= p_dq->capacity)
+    {
+        p_dq->ridx = 0;
+    }
+    p_dq->b_is_full = false;
+
+    return true;
+} /* End of deque_pop_front() */
+
+/*!
+ * @brief Removes the element at the back of the deque.
+ * @param[in,out] p_dq Pointer to the deque.
+ * @param[out] p_data Pointer to the variable that receives the element.
+ * @return true If an element was removed.
+ * @return false If p_dq or p_data is NULL, or the deque is empty.
+ * @note Time complexity: O(1)
+ */
+bool deque_pop_back(deque_t *p_dq, int32_t *p_data)
+{
+    if (NULL == p_dq || NULL == p_data)
+    {
+        return false;
+    }
+
+    if ((p_dq->widx == p_dq->ridx) && !p_dq->b_is_full)
+    {
+        /* Cannot pop from an empty deque. */
+        return false;
+    }
+
+    /* Step the write index back. */
+    if (0 == p_dq->widx)
+    {
+        p_dq->widx = p_dq->capacity;
+    }
+    p_dq->widx--;
+    *p_data = p_dq->p_buf[p_dq->widx];
+    p_dq->b_is_full = false;
+
+    return true;
+} /* End of deque_pop_back() */
+
+/*!
+ * @brief Returns the element at the front of the deque without removing it.
+ * @param[in] p_dq Pointer to the deque.
+ * @param[out] p_data Pointer to the variable that receives the element.
+ * @return true If the peek was successful.
+ * @return false If p_dq or p_data is NULL, or the deque is empty.
+ * @note Time complexity: O(1)
+ */
+bool deque_peek_front(const deque_t *p_dq, int32_t *p_data)
+{
+    return deque_at(p_dq, 0, p_data);
+} /* End of deque_peek_front() */
+
+/*!
+ * @brief Returns the element at the back of the deque without removing it.
+ * @param[in] p_dq Pointer to the deque.
+ * @param[out] p_data Pointer to the variable that receives the element.
+ * @return true If the peek was successful.
+ * @return false If p_dq or p_data is NULL, or the deque is empty.
+ * @note Time complexity: O(1)
+ */
+bool deque_peek_back(const deque_t *p_dq, int32_t *p_data)
+{
+    uint32_t size = deque_size(p_dq);
+
+    if (0 == size)
+    {
+        return false;
+    }
+
+    return deque_at(p_dq, size - 1, p_data);
+} /* End of deque_peek_back() */
+
+/*!
+ * @brief Returns the element at a position counted from the front.
+ * @param[in] p_dq Pointer to the deque.
+ * @param[in] index Position of the element; 0 is the front element.
+ * @param[out] p_data Pointer to the variable that receives the element.
+ * @return true If the element exists.
+ * @return false If p_dq or p_data is NULL, or index is out of range.
+ * @note Time complexity: O(1)
+ */
+bool deque_at(const deque_t *p_dq, uint32_t index, int32_t *p_data)
+{
+    if (NULL == p_dq || NULL == p_data)
+    {
+        return false;
+    }
+
+    if (index >= deque_size(p_dq))
+    {
+        return false;
+    }
+
+    /* Both operands are below capacity, so one subtraction wraps. */
+    uint32_t idx = index;
+    if (idx >= (p_dq->capacity - p_dq->ridx))
+    {
+        idx -= (p_dq->capacity - p_dq->ridx);
+    }
+    else
+    {
+        idx += p_dq->ridx;
+    }
+
+    *p_data = p_dq->p_buf[idx];
+
+    return true;
+} /* End of deque_at() */
+
+/*!
+ * @brief Counts the number of elements in the deque.
+ * @param[in] p_dq Pointer to the deque.
+ * @return Number of elements. Returns 0 if p_dq is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t deque_size(const deque_t *p_dq)
+{
+    if (NULL == p_dq)
+    {
+        return 0;
+    }
+
+    if (p_dq->widx == p_dq->ridx)
+    {
+        return p_dq->b_is_full ? p_dq->capacity : 0;
+    }
+    else if (p_dq->widx > p_dq->ridx)
+    {
+        return p_dq->widx - p_dq->ridx;
+    }
+    else
+    {
+        return p_dq->capacity - (p_dq->ridx - p_dq->widx);
+    }
+} /* End of deque_size() */
+
+/*!
+ * @brief Returns the number of elements the deque can hold before growing.
+ * @param[in] p_dq Pointer to the deque.
+ * @return Current capacity. Returns 0 if p_dq is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t deque_capacity(const deque_t *p_dq)
+{
+    if (NULL == p_dq)
+    {
+        return 0;
+    }
+
+    return p_dq->capacity;
+} /* End of deque_capacity() */
+
+/*!
+ * @brief Checks whether the deque is empty.
+ * @param[in] p_dq Pointer to the deque.
+ * @return true If the deque is empty.
+ * @return false If the deque has elements, or p_dq is NULL.
+ * @note Time complexity: O(1)
+ */
+bool deque_is_empty(const deque_t *p_dq)
+{
+    if (NULL == p_dq)
+    {
+        return false;
+    }
+
+    return (p_dq->widx == p_dq->ridx) && !p_dq->b_is_full;
+} /* End of deque_is_empty() */
+
+/*!
+ * @brief Removes all elements from the deque.
+ * @param[in,out] p_dq Pointer to the deque.
+ * @return true If the deque was cleared.
+ * @return false If p_dq is NULL.
+ * @note Time complexity: O(1). The capacity is kept.
+ */
+bool deque_clear(deque_t *p_dq)
+{
+    if (NULL == p_dq)
+    {
+        return false;
+    }
+
+    p_dq->ridx = 0;
+    p_dq->widx = 0;
+    p_dq->b_is_full = false;
+
+    return true;
+} /* End of deque_clear() */
+
+/*!
+ * @brief Destroys a deque and releases all associated resources.
+ * @param[in] p_dq Pointer to the deque.
+ * @note Time complexity: O(1)
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void deque_destroy(deque_t *p_dq)
+{
+    if (NULL == p_dq)
+    {
+        return;
+    }
+
+    free(p_dq->p_buf);
+    free(p_dq);
+} /* End of deque_destroy() */
+
+/*!
+ * @brief Displays all elements from front to back.
+ * @param[in] p_dq Pointer to the deque.
+ * @note Time complexity: O(n), where n is the number of elements.
+ */
+void deque_display(const deque_t *p_dq)
+{
+    if (NULL == p_dq)
+    {
+        return;
+    }
+
+    uint32_t idx = p_dq->ridx;
+    uint32_t count = deque_size(p_dq);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        printf("%d ", p_dq->p_buf[idx]);
+
+        idx++;
+        if (idx >= p_dq->capacity)
+        {
+            idx = 0;
+        }
+    }
+
+    printf("\n");
+} /* End of deque_display() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Doubles the capacity of a full deque.
+ * @param[in,out] p_dq Pointer to the deque.
+ * @return true If the deque has free space on return.
+ * @return false If the capacity cannot be doubled or memory allocation fails;
+ * the deque is left unchanged.
+ * @note Time complexity: O(n). The elements are copied to the start of the new
+ * array in order, so ridx becomes 0.
+ */
+static bool deque_grow(deque_t *p_dq)
+{
+    if (p_dq->capacity > (UINT32_MAX / 2U))
+    {
+        return false;
+    }
+
+    uint32_t new_capacity = p_dq->capacity * 2U;
+    int32_t *p_new = malloc((size_t)new_capacity * sizeof(int32_t));
+    if (NULL == p_new)
+    {
+        /* Memory allocation failed. */
+        return false;
+    }
+
+    /* A full deque is stored as [ridx, capacity) followed by [0, widx). */
+    uint32_t first = p_dq->capacity - p_dq->ridx;
+    memcpy(p_new, &p_dq->p_buf[p_dq->ridx], first * sizeof(int32_t));
+    memcpy(&p_new[first], p_dq->p_buf, p_dq->widx * sizeof(int32_t));
+
+    free(p_dq->p_buf);
+    p_dq->p_buf = p_new;
+    p_dq->ridx = 0;
+    p_dq->widx = p_dq->capacity;
+    p_dq->capacity = new_capacity;
+    p_dq->b_is_full = false;
+
+    return true;
+} /* End of deque_grow() */
+
+/*** End of file: deque.c */
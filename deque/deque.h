@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * 
+ * @file    deque.h
+ * @brief   Public APIs for a growable double-ended queue.
+ * @details This module provides an opaque double-ended queue stored in one
+ *          circular array, indexed the same way as the ring buffer (rbuffer).
+ *          Elements can be pushed and popped at both ends and accessed by
+ *          position in O(1), with the locality of an array. When the array is
+ *          full, its capacity is doubled instead of overwriting old data.
+ *          Users must interact with the deque only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The internal data structures are opaque to users to prevent
+ *          accidental violation of deque invariants.
+ * 
+ ******************************************************************************/
+
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct deque_t deque_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+deque_t* deque_create(uint32_t capacity);
+bool deque_push_front(deque_t *p_dq, int32_t data);
+bool deque_push_back(deque_t *p_dq, int32_t data);
+bool deque_pop_front(deque_t *p_dq, int32_t *p_data);
+bool deque_pop_back(deque_t *p_dq, int32_t *p_data);
+bool deque_peek_front(const deque_t *p_dq, int32_t *p_data);
+bool deque_peek_back(const deque_t *p_dq, int32_t *p_data);
+bool deque_at(const deque_t *p_dq, uint32_t index, int32_t *p_data);
+uint32_t deque_size(const deque_t *p_dq);
+uint32_t deque_capacity(const deque_t *p_dq);
+bool deque_is_empty(const deque_t *p_dq);
+bool deque_clear(deque_t *p_dq);
+void deque_destroy(deque_t *p_dq);
+void deque_display(const deque_t *p_dq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEQUE_H */
+
+/*** End of file: deque.h */
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the double-ended queue module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "deque.h"
+
+#define INITIAL_CAPACITY (4)
+
+int main(int argc, char *argv[])
+{
+    int32_t data;
+
+    deque_t *p_dq = deque_create(INITIAL_CAPACITY);
+    printf("%d\n", deque_is_empty(p_dq)); /* 1 */
+
+    /* Queue and stack usage at both ends. */
+    deque_push_back(p_dq, 1);
+    deque_push_back(p_dq, 2);
+    deque_push_front(p_dq, 0);
+    deque_push_front(p_dq, -1);
+    deque_display(p_dq); /* -1 0 1 2 */
+    printf("%u\n", deque_capacity(p_dq)); /* 4 */
+
+    /* The array is full: the next push doubles it. */
+    deque_push_back(p_dq, 3);
+    deque_display(p_dq); /* -1 0 1 2 3 */
+    printf("%u\n", deque_capacity(p_dq)); /* 8 */
+
+    /* Random access. */
+    deque_at(p_dq, 2, &data);
+    printf("%d\n", data); /* 1 */
+    printf("%d\n", deque_at(p_dq, 5, &data)); /* 0 */
+
+    deque_pop_front(p_dq, &data);
+    printf("%d\n", data); /* -1 */
+    deque_pop_back(p_dq, &data);
+    printf("%d\n", data); /* 3 */
+    deque_peek_front(p_dq, &data);
+    printf("%d\n", data); /* 0 */
+    deque_peek_back(p_dq, &data);
+    printf("%d\n", data); /* 2 */
+    printf("%u\n", deque_size(p_dq)); /* 3 */
+
+    deque_clear(p_dq);
+    printf("%d\n", deque_pop_back(p_dq, &data)); /* 0 */
+    deque_display(p_dq); /* (none) */
+
+    deque_destroy(p_dq);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
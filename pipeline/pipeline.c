@@ -0,0 +1,810 @@
+/*******************************************************************************
+ *
+ * @file    pipeline.c
+ * @brief   Implementation of a multi-stage thread pipeline.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definitions of pipeline_t, pipeline_stage_t and pipeline_ring_t
+ *          are intentionally kept private to this source file to enforce
+ *          encapsulation. Users of this module interact with the pipeline only
+ *          through the public API and cannot access or modify internal members
+ *          directly.
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include "pipeline.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define CACHE_LINE_SIZE (64)
+#define SPIN_LIMIT      (64)    /* Empty polls before yielding the CPU. */
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Lock-free SPSC ring connecting two adjacent stages.
+ * @note Unlike rbuffer_t, the read and write indices run freely and are only
+ * masked on access, so each side owns exactly one index and the full/empty
+ * states need no shared flag. The capacity is therefore a power of two. Each
+ * side keeps a cached copy of the other side's index, refreshed only when the
+ * cached value suggests the ring is full (or empty).
+ */
+typedef struct
+{
+    int32_t *p_buf;
+    uint32_t capacity;
+    uint32_t mask;
+
+    _Alignas(CACHE_LINE_SIZE) _Atomic uint32_t ridx; /* Consumer-owned. */
+    uint32_t widx_cache;                            /* Consumer-local. */
+
+    _Alignas(CACHE_LINE_SIZE) _Atomic uint32_t widx; /* Producer-owned. */
+    uint32_t ridx_cache;                            /* Producer-local. */
+
+    _Alignas(CACHE_LINE_SIZE) atomic_bool b_closed; /* Producer finished. */
+    atomic_bool b_detached;                          /* Consumer finished. */
+} pipeline_ring_t;
+
+/*!
+ * @brief Structure representing one stage and its thread.
+ * @note The counters are written only by the stage thread and read by
+ * pipeline_get_stats() from any thread.
+ */
+typedef struct
+{
+    pipeline_t *p_pl;
+    pipeline_stage_fn_t fn;
+    void *p_ctx;
+    int cpu;
+    pthread_t thread;
+    bool b_thread_valid;
+
+    pipeline_ring_t *p_in;   /* NULL for the source. */
+    pipeline_ring_t *p_out;  /* NULL for the sink. */
+    int32_t *p_in_batch;
+    int32_t *p_out_batch;
+
+    _Atomic uint64_t items_in;
+    _Atomic uint64_t items_out;
+    _Atomic uint64_t calls;
+    _Atomic uint64_t in_stalls;
+    _Atomic uint64_t out_stalls;
+    _Atomic uint64_t occupancy_sum;
+    _Atomic uint64_t occupancy_samples;
+    _Atomic uint64_t start_ns;
+    _Atomic uint64_t stop_ns;
+} pipeline_stage_t;
+
+/*!
+ * @brief Structure representing a pipeline.
+ * @note This structure is opaque to users of the API. Stage i reads from
+ * p_rings[i - 1] and writes to p_rings[i].
+ */
+struct pipeline_t
+{
+    pipeline_stage_t stages[PIPELINE_MAX_STAGES];
+    pipeline_ring_t *p_rings[PIPELINE_MAX_STAGES - 1];
+    uint32_t stage_count;
+    uint32_t ring_capacity;
+    uint32_t batch_size;
+    atomic_bool b_stop;
+    bool b_started;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void pipeline_unwire(pipeline_t *p_pl);
+static pipeline_ring_t* ring_create(uint32_t capacity);
+static void ring_destroy(pipeline_ring_t *p_ring);
+static uint32_t ring_write(pipeline_ring_t *p_ring, const int32_t *p_src,
+                           uint32_t count);
+static uint32_t ring_read(pipeline_ring_t *p_ring, int32_t *p_dst,
+                          uint32_t count, uint32_t *p_avail);
+static uint32_t ring_count(pipeline_ring_t *p_ring);
+static bool stage_push(pipeline_stage_t *p_stage, uint32_t count);
+static void* stage_main(void *p_arg);
+static void stat_add(_Atomic uint64_t *p_stat, uint64_t value);
+static void backoff(uint32_t *p_spins);
+static uint64_t now_ns(void);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates an empty pipeline.
+ * @param[in] ring_capacity Capacity of each ring between two stages. Rounded up
+ * to the next power of two.
+ * @param[in] batch_size Maximum number of elements passed to or returned from a
+ * stage function per call.
+ * @return Pointer to the created pipeline, or NULL if an argument is 0 or out
+ * of range, or if memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling pipeline_destroy().
+ */
+pipeline_t* pipeline_create(uint32_t ring_capacity, uint32_t batch_size)
+{
+    if ((ring_capacity < 1) || (ring_capacity > (UINT32_C(1) << 31)) ||
+        (batch_size < 1))
+    {
+        return NULL;
+    }
+
+    pipeline_t *p_pl = calloc(1, sizeof(pipeline_t));
+    if (NULL == p_pl)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    /* Round the ring capacity up to a power of two. */
+    uint32_t capacity = 1;
+    while (capacity < ring_capacity)
+    {
+        capacity <<= 1;
+    }
+
+    p_pl->ring_capacity = capacity;
+    p_pl->batch_size = batch_size;
+    atomic_init(&p_pl->b_stop, false);
+
+    return p_pl;
+} /* End of pipeline_create() */
+
+/*!
+ * @brief Appends a stage to the pipeline.
+ * @param[in,out] p_pl Pointer to the pipeline.
+ * @param[in] fn Stage function. The first stage added is the source and the
+ * last one is the sink.
+ * @param[in] p_ctx User context passed to every call of fn.
+ * @param[in] cpu CPU to pin the stage thread to, or PIPELINE_NO_PIN.
+ * @return true If the stage was added.
+ * @return false If p_pl or fn is NULL, the pipeline is already started, or
+ * PIPELINE_MAX_STAGES stages have been added.
+ * @note Time complexity: O(1)
+ */
+bool pipeline_add_stage(pipeline_t *p_pl, pipeline_stage_fn_t fn, void *p_ctx,
+                        int cpu)
+{
+    if (NULL == p_pl || NULL == fn)
+    {
+        return false;
+    }
+
+    if (p_pl->b_started || (p_pl->stage_count >= PIPELINE_MAX_STAGES))
+    {
+        return false;
+    }
+
+    pipeline_stage_t *p_stage = &p_pl->stages[p_pl->stage_count];
+    p_stage->p_pl = p_pl;
+    p_stage->fn = fn;
+    p_stage->p_ctx = p_ctx;
+    p_stage->cpu = cpu;
+
+    p_pl->stage_count++;
+
+    return true;
+} /* End of pipeline_add_stage() */
+
+/*!
+ * @brief Creates the rings and starts one thread per stage.
+ * @param[in,out] p_pl Pointer to the pipeline.
+ * @return true If all stage threads were started.
+ * @return false If p_pl is NULL, has no stage, is already started, or if
+ * memory allocation or thread creation fails. After an allocation failure
+ * nothing is kept and the call may be retried. After a thread creation
+ * failure, the threads already started are stopped and joined, and the
+ * pipeline cannot be started again.
+ * @note Time complexity: O(s), where s is the number of stages.
+ */
+bool pipeline_start(pipeline_t *p_pl)
+{
+    if (NULL == p_pl)
+    {
+        return false;
+    }
+
+    if (p_pl->b_started || (0 == p_pl->stage_count))
+    {
+        return false;
+    }
+
+    /* Wire up the rings and per-stage batch buffers. */
+    for (uint32_t i = 0; i < p_pl->stage_count; i++)
+    {
+        pipeline_stage_t *p_stage = &p_pl->stages[i];
+
+        if ((i + 1) < p_pl->stage_count)
+        {
+            p_pl->p_rings[i] = ring_create(p_pl->ring_capacity);
+            if (NULL == p_pl->p_rings[i])
+            {
+                pipeline_unwire(p_pl);
+                return false;
+            }
+            p_stage->p_out = p_pl->p_rings[i];
+            p_stage->p_out_batch = malloc(p_pl->batch_size * sizeof(int32_t));
+            if (NULL == p_stage->p_out_batch)
+            {
+                pipeline_unwire(p_pl);
+                return false;
+            }
+        }
+
+        if (i > 0)
+        {
+            p_stage->p_in = p_pl->p_rings[i - 1];
+            p_stage->p_in_batch = malloc(p_pl->batch_size * sizeof(int32_t));
+            if (NULL == p_stage->p_in_batch)
+            {
+                pipeline_unwire(p_pl);
+                return false;
+            }
+        }
+    }
+
+    p_pl->b_started = true;
+
+    /* Start the threads. */
+    for (uint32_t i = 0; i < p_pl->stage_count; i++)
+    {
+        pipeline_stage_t *p_stage = &p_pl->stages[i];
+
+        if (0 != pthread_create(&p_stage->thread, NULL, stage_main, p_stage))
+        {
+            /* Unwind: closing the source makes every started stage exit. */
+            atomic_store(&p_pl->b_stop, true);
+            if (NULL != p_stage->p_in)
+            {
+                atomic_store(&p_stage->p_in->b_detached, true);
+            }
+            if (NULL != p_stage->p_out)
+            {
+                atomic_store(&p_stage->p_out->b_closed, true);
+            }
+            (void)pipeline_wait(p_pl);
+            return false;
+        }
+        p_stage->b_thread_valid = true;
+    }
+
+    return true;
+} /* End of pipeline_start() */
+
+/*!
+ * @brief Requests an orderly shutdown of the pipeline.
+ * @param[in,out] p_pl Pointer to the pipeline.
+ * @note The source stops being called; every downstream stage drains what is
+ * already in its input ring, receives its end-of-stream call and exits. Use
+ * pipeline_wait() to wait for completion.
+ * @note It is safe to call this function from any thread, or with NULL.
+ */
+void pipeline_stop(pipeline_t *p_pl)
+{
+    if (NULL == p_pl)
+    {
+        return;
+    }
+
+    atomic_store(&p_pl->b_stop, true);
+} /* End of pipeline_stop() */
+
+/*!
+ * @brief Waits until every stage thread has exited.
+ * @param[in,out] p_pl Pointer to the pipeline.
+ * @return true If all started threads were joined.
+ * @return false If p_pl is NULL or a join failed.
+ * @note Time complexity: O(s), where s is the number of stages.
+ */
+bool pipeline_wait(pipeline_t *p_pl)
+{
+    if (NULL == p_pl)
+    {
+        return false;
+    }
+
+    bool b_ok = true;
+
+    for (uint32_t i = 0; i < p_pl->stage_count; i++)
+    {
+        pipeline_stage_t *p_stage = &p_pl->stages[i];
+
+        if (p_stage->b_thread_valid)
+        {
+            if (0 != pthread_join(p_stage->thread, NULL))
+            {
+                b_ok = false;
+            }
+            p_stage->b_thread_valid = false;
+        }
+    }
+
+    return b_ok;
+} /* End of pipeline_wait() */
+
+/*!
+ * @brief Returns the number of stages in the pipeline.
+ * @param[in] p_pl Pointer to the pipeline.
+ * @return Number of stages. Returns 0 if p_pl is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t pipeline_stage_count(const pipeline_t *p_pl)
+{
+    if (NULL == p_pl)
+    {
+        return 0;
+    }
+
+    return p_pl->stage_count;
+} /* End of pipeline_stage_count() */
+
+/*!
+ * @brief Takes a snapshot of the metrics of a stage.
+ * @param[in] p_pl Pointer to the pipeline.
+ * @param[in] stage Index of the stage, in the order the stages were added.
+ * @param[out] p_stats Pointer to the structure that receives the metrics.
+ * @return true If the metrics were copied.
+ * @return false If p_pl or p_stats is NULL, or stage is out of range.
+ * @note Time complexity: O(1)
+ * @note May be called while the pipeline is running. Individual counters are
+ * consistent, but they are not sampled at the same instant.
+ */
+bool pipeline_get_stats(const pipeline_t *p_pl, uint32_t stage,
+                        pipeline_stats_t *p_stats)
+{
+    if (NULL == p_pl || NULL == p_stats)
+    {
+        return false;
+    }
+
+    if (stage >= p_pl->stage_count)
+    {
+        return false;
+    }
+
+    /* Counters are atomics; casting away const only permits the loads. */
+    pipeline_stage_t *p_stage = (pipeline_stage_t *)&p_pl->stages[stage];
+
+    memset(p_stats, 0, sizeof(*p_stats));
+    p_stats->items_in = atomic_load_explicit(&p_stage->items_in,
+                                             memory_order_relaxed);
+    p_stats->items_out = atomic_load_explicit(&p_stage->items_out,
+                                              memory_order_relaxed);
+    p_stats->calls = atomic_load_explicit(&p_stage->calls,
+                                          memory_order_relaxed);
+    p_stats->in_stalls = atomic_load_explicit(&p_stage->in_stalls,
+                                              memory_order_relaxed);
+    p_stats->out_stalls = atomic_load_explicit(&p_stage->out_stalls,
+                                               memory_order_relaxed);
+
+    uint64_t start_ns = atomic_load_explicit(&p_stage->start_ns,
+                                             memory_order_relaxed);
+    uint64_t stop_ns = atomic_load_explicit(&p_stage->stop_ns,
+                                            memory_order_relaxed);
+    if (0 != start_ns)
+    {
+        p_stats->run_ns = ((0 != stop_ns) ? stop_ns : now_ns()) - start_ns;
+    }
+
+    if (NULL != p_stage->p_in)
+    {
+        uint64_t samples = atomic_load_explicit(&p_stage->occupancy_samples,
+                                                memory_order_relaxed);
+        uint64_t sum = atomic_load_explicit(&p_stage->occupancy_sum,
+                                            memory_order_relaxed);
+
+        p_stats->in_capacity = p_stage->p_in->capacity;
+        p_stats->in_occupancy = ring_count(p_stage->p_in);
+        p_stats->in_occupancy_avg = (0 != samples) ?
+                                    ((double)sum / (double)samples) : 0.0;
+    }
+
+    return true;
+} /* End of pipeline_get_stats() */
+
+/*!
+ * @brief Stops and joins all stage threads, then releases all resources.
+ * @param[in] p_pl Pointer to the pipeline.
+ * @note Time complexity: O(s), where s is the number of stages.
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void pipeline_destroy(pipeline_t *p_pl)
+{
+    if (NULL == p_pl)
+    {
+        return;
+    }
+
+    pipeline_stop(p_pl);
+    (void)pipeline_wait(p_pl);
+
+    pipeline_unwire(p_pl);
+
+    free(p_pl);
+} /* End of pipeline_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Releases the rings and batch buffers created by pipeline_start(), and
+ * disconnects the stages from them.
+ * @param[in,out] p_pl Pointer to the pipeline. Its stage threads must not be
+ * running.
+ */
+static void pipeline_unwire(pipeline_t *p_pl)
+{
+    for (uint32_t i = 0; i < p_pl->stage_count; i++)
+    {
+        pipeline_stage_t *p_stage = &p_pl->stages[i];
+
+        free(p_stage->p_in_batch);
+        free(p_stage->p_out_batch);
+        p_stage->p_in_batch = NULL;
+        p_stage->p_out_batch = NULL;
+        p_stage->p_in = NULL;
+        p_stage->p_out = NULL;
+    }
+
+    for (uint32_t i = 0; i < (PIPELINE_MAX_STAGES - 1); i++)
+    {
+        ring_destroy(p_pl->p_rings[i]);
+        p_pl->p_rings[i] = NULL;
+    }
+} /* End of pipeline_unwire() */
+
+/*!
+ * @brief Creates an empty SPSC ring.
+ * @param[in] capacity Number of elements; must be a power of two.
+ * @return Pointer to the ring, or NULL if memory allocation fails.
+ */
+static pipeline_ring_t* ring_create(uint32_t capacity)
+{
+    /* aligned_alloc() requires a size that is a multiple of the alignment. */
+    size_t size = (sizeof(pipeline_ring_t) + CACHE_LINE_SIZE - 1) &
+                  ~((size_t)CACHE_LINE_SIZE - 1);
+
+    pipeline_ring_t *p_ring = aligned_alloc(CACHE_LINE_SIZE, size);
+    if (NULL == p_ring)
+    {
+        return NULL;
+    }
+
+    p_ring->p_buf = malloc(capacity * sizeof(int32_t));
+    if (NULL == p_ring->p_buf)
+    {
+        free(p_ring);
+        return NULL;
+    }
+
+    p_ring->capacity = capacity;
+    p_ring->mask = capacity - 1;
+    atomic_init(&p_ring->ridx, 0);
+    atomic_init(&p_ring->widx, 0);
+    p_ring->widx_cache = 0;
+    p_ring->ridx_cache = 0;
+    atomic_init(&p_ring->b_closed, false);
+    atomic_init(&p_ring->b_detached, false);
+
+    return p_ring;
+} /* End of ring_create() */
+
+/*!
+ * @brief Releases an SPSC ring. Does nothing if p_ring is NULL.
+ * @param[in] p_ring Pointer to the ring.
+ */
+static void ring_destroy(pipeline_ring_t *p_ring)
+{
+    if (NULL == p_ring)
+    {
+        return;
+    }
+
+    free(p_ring->p_buf);
+    free(p_ring);
+} /* End of ring_destroy() */
+
+/*!
+ * @brief Writes up to count elements into the ring (producer side only).
+ * @param[in,out] p_ring Pointer to the ring.
+ * @param[in] p_src Elements to write.
+ * @param[in] count Number of elements in p_src.
+ * @return Number of elements written, limited by the free space.
+ * @note At most two memcpy() calls, one per side of the wrap point.
+ */
+static uint32_t ring_write(pipeline_ring_t *p_ring, const int32_t *p_src,
+                           uint32_t count)
+{
+    uint32_t widx = atomic_load_explicit(&p_ring->widx, memory_order_relaxed);
+    uint32_t free_count = p_ring->capacity - (widx - p_ring->ridx_cache);
+
+    if (free_count < count)
+    {
+        /* Refresh the cached consumer index only when it looks too full. */
+        p_ring->ridx_cache = atomic_load_explicit(&p_ring->ridx,
+                                                  memory_order_acquire);
+        free_count = p_ring->capacity - (widx - p_ring->ridx_cache);
+    }
+
+    uint32_t n = (count < free_count) ? count : free_count;
+    uint32_t offset = widx & p_ring->mask;
+    uint32_t first = p_ring->capacity - offset;
+    if (first > n)
+    {
+        first = n;
+    }
+
+    memcpy(&p_ring->p_buf[offset], p_src, first * sizeof(int32_t));
+    memcpy(p_ring->p_buf, &p_src[first], (n - first) * sizeof(int32_t));
+
+    atomic_store_explicit(&p_ring->widx, widx + n, memory_order_release);
+
+    return n;
+} /* End of ring_write() */
+
+/*!
+ * @brief Reads up to count elements from the ring (consumer side only).
+ * @param[in,out] p_ring Pointer to the ring.
+ * @param[out] p_dst Buffer receiving the elements.
+ * @param[in] count Capacity of p_dst.
+ * @param[out] p_avail Number of elements that were available before reading.
+ * @return Number of elements read.
+ */
+static uint32_t ring_read(pipeline_ring_t *p_ring, int32_t *p_dst,
+                          uint32_t count, uint32_t *p_avail)
+{
+    uint32_t ridx = atomic_load_explicit(&p_ring->ridx, memory_order_relaxed);
+    uint32_t avail = p_ring->widx_cache - ridx;
+
+    if (avail < count)
+    {
+        /* Refresh the cached producer index only when it looks too empty. */
+        p_ring->widx_cache = atomic_load_explicit(&p_ring->widx,
+                                                  memory_order_acquire);
+        avail = p_ring->widx_cache - ridx;
+    }
+
+    uint32_t n = (count < avail) ? count : avail;
+    uint32_t offset = ridx & p_ring->mask;
+    uint32_t first = p_ring->capacity - offset;
+    if (first > n)
+    {
+        first = n;
+    }
+
+    memcpy(p_dst, &p_ring->p_buf[offset], first * sizeof(int32_t));
+    memcpy(&p_dst[first], p_ring->p_buf, (n - first) * sizeof(int32_t));
+
+    atomic_store_explicit(&p_ring->ridx, ridx + n, memory_order_release);
+
+    *p_avail = avail;
+    return n;
+} /* End of ring_read() */
+
+/*!
+ * @brief Returns the number of elements in the ring, as seen by any thread.
+ * @param[in] p_ring Pointer to the ring.
+ */
+static uint32_t ring_count(pipeline_ring_t *p_ring)
+{
+    uint32_t ridx = atomic_load_explicit(&p_ring->ridx, memory_order_acquire);
+    uint32_t widx = atomic_load_explicit(&p_ring->widx, memory_order_acquire);
+
+    return widx - ridx;
+} /* End of ring_count() */
+
+/*!
+ * @brief Pushes the stage's output batch downstream, applying backpressure.
+ * @param[in,out] p_stage Pointer to the stage.
+ * @param[in] count Number of elements in the output batch.
+ * @return true If every element was pushed.
+ * @return false If the downstream stage has exited; the rest is dropped.
+ */
+static bool stage_push(pipeline_stage_t *p_stage, uint32_t count)
+{
+    uint32_t done = 0;
+    uint32_t spins = 0;
+
+    while (done < count)
+    {
+        uint32_t n = ring_write(p_stage->p_out, &p_stage->p_out_batch[done],
+                                count - done);
+        if (0 == n)
+        {
+            /* Output ring is full: wait for the consumer. */
+            if (atomic_load_explicit(&p_stage->p_out->b_detached,
+                                     memory_order_acquire))
+            {
+                return false;
+            }
+            stat_add(&p_stage->out_stalls, 1);
+            backoff(&spins);
+            continue;
+        }
+
+        done += n;
+        spins = 0;
+        stat_add(&p_stage->items_out, n);
+    }
+
+    return true;
+} /* End of stage_push() */
+
+/*!
+ * @brief Thread entry point running one stage until its input ends.
+ * @param[in] p_arg Pointer to the pipeline_stage_t to run.
+ * @return Always NULL.
+ */
+static void* stage_main(void *p_arg)
+{
+    pipeline_stage_t *p_stage = p_arg;
+    pipeline_t *p_pl = p_stage->p_pl;
+    uint32_t batch_size = p_pl->batch_size;
+    bool b_input_ended = false;
+    bool b_running = true;
+    uint32_t spins = 0;
+
+#ifdef __linux__
+    if (p_stage->cpu >= 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(p_stage->cpu, &cpus);
+
+        /* Pinning is best effort; the stage still runs if it fails. */
+        (void)pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#endif
+
+    atomic_store_explicit(&p_stage->start_ns, now_ns(), memory_order_relaxed);
+
+    while (b_running)
+    {
+        uint32_t in_count = 0;
+        uint32_t out_count = (NULL != p_stage->p_out) ? batch_size : 0;
+
+        if (NULL == p_stage->p_in)
+        {
+            /* Source: runs until exhausted or asked to stop. */
+            if (atomic_load_explicit(&p_pl->b_stop, memory_order_acquire))
+            {
+                break;
+            }
+        }
+        else
+        {
+            uint32_t avail;
+
+            in_count = ring_read(p_stage->p_in, p_stage->p_in_batch,
+                                 batch_size, &avail);
+            if (0 == in_count)
+            {
+                if (atomic_load_explicit(&p_stage->p_in->b_closed,
+                                         memory_order_acquire))
+                {
+                    /* Data written before closing is visible now. */
+                    in_count = ring_read(p_stage->p_in, p_stage->p_in_batch,
+                                         batch_size, &avail);
+                    if (0 == in_count)
+                    {
+                        b_input_ended = true;
+                        break;
+                    }
+                }
+                else
+                {
+                    stat_add(&p_stage->in_stalls, 1);
+                    backoff(&spins);
+                    continue;
+                }
+            }
+
+            spins = 0;
+            stat_add(&p_stage->items_in, in_count);
+            stat_add(&p_stage->occupancy_sum, avail);
+            stat_add(&p_stage->occupancy_samples, 1);
+        }
+
+        stat_add(&p_stage->calls, 1);
+        b_running = p_stage->fn(p_stage->p_ctx,
+                                (NULL != p_stage->p_in) ?
+                                p_stage->p_in_batch : NULL,
+                                in_count, p_stage->p_out_batch, &out_count);
+
+        if (!b_running && (NULL != p_stage->p_in))
+        {
+            /* A non-source stage gave up: shut the whole pipeline down. */
+            atomic_store_explicit(&p_pl->b_stop, true, memory_order_release);
+        }
+
+        if ((NULL != p_stage->p_out) && (out_count > 0))
+        {
+            if (!stage_push(p_stage, out_count))
+            {
+                b_running = false;
+            }
+        }
+    }
+
+    if (b_input_ended)
+    {
+        /* End of stream: let the stage flush any pending state. */
+        uint32_t out_count = (NULL != p_stage->p_out) ? batch_size : 0;
+
+        stat_add(&p_stage->calls, 1);
+        (void)p_stage->fn(p_stage->p_ctx, NULL, 0, p_stage->p_out_batch,
+                          &out_count);
+        if ((NULL != p_stage->p_out) && (out_count > 0))
+        {
+            (void)stage_push(p_stage, out_count);
+        }
+    }
+
+    if (NULL != p_stage->p_in)
+    {
+        atomic_store_explicit(&p_stage->p_in->b_detached, true,
+                              memory_order_release);
+    }
+
+    if (NULL != p_stage->p_out)
+    {
+        atomic_store_explicit(&p_stage->p_out->b_closed, true,
+                              memory_order_release);
+    }
+
+    atomic_store_explicit(&p_stage->stop_ns, now_ns(), memory_order_relaxed);
+
+    return NULL;
+} /* End of stage_main() */
+
+/*!
+ * @brief Adds to a counter that has a single writer.
+ * @param[in,out] p_stat Pointer to the counter.
+ * @param[in] value Value to add.
+ * @note A relaxed load/store pair avoids a locked read-modify-write, which is
+ * safe because only the owning stage thread updates its counters.
+ */
+static void stat_add(_Atomic uint64_t *p_stat, uint64_t value)
+{
+    uint64_t curr = atomic_load_explicit(p_stat, memory_order_relaxed);
+
+    atomic_store_explicit(p_stat, curr + value, memory_order_relaxed);
+} /* End of stat_add() */
+
+/*!
+ * @brief Waits briefly before polling a ring again.
+ * @param[in,out] p_spins Number of consecutive unsuccessful polls.
+ */
+static void backoff(uint32_t *p_spins)
+{
+    if (*p_spins < SPIN_LIMIT)
+    {
+        (*p_spins)++;
+    }
+    else
+    {
+        (void)sched_yield();
+    }
+} /* End of backoff() */
+
+/*!
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * UINT64_C(1000000000)) + (uint64_t)ts.tv_nsec;
+} /* End of now_ns() */
+
+/*** End of file: pipeline.c */
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * @file    pipeline.h
+ * @brief   Public APIs for a multi-stage thread pipeline.
+ * @details This module runs a linear chain of stages, each on its own thread,
+ *          connected by single-producer single-consumer (SPSC) rings that are
+ *          read and written in batches. The module takes care of thread
+ *          pinning, backpressure, orderly shutdown and per-stage metrics, so
+ *          stages can be added, removed or reordered without re-tuning.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The internal data structures are opaque to users to prevent
+ *          accidental violation of pipeline invariants.
+ *
+ ******************************************************************************/
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+#define PIPELINE_MAX_STAGES (16)
+#define PIPELINE_NO_PIN     (-1)    /* Do not pin the stage to a CPU. */
+
+/* Public data types ---------------------------------------------------------*/
+
+/*!
+ * @brief Stage function called repeatedly on the stage's own thread.
+ * @param[in,out] p_ctx User context given to pipeline_add_stage().
+ * @param[in] p_in Batch of input data, or NULL for the first stage (source)
+ * and for the final end-of-stream call.
+ * @param[in] in_count Number of elements in p_in. A non-source stage is called
+ * once with in_count 0 after its input has ended, to flush pending state.
+ * @param[out] p_out Output batch, or NULL for the last stage (sink).
+ * @param[in,out] p_out_count Capacity of p_out on entry, number of elements
+ * produced on return.
+ * @return true To keep running.
+ * @return false To stop this stage. For the source this means the input is
+ * exhausted; for any other stage it aborts the pipeline.
+ */
+typedef bool (*pipeline_stage_fn_t)(void *p_ctx, const int32_t *p_in,
+                                    uint32_t in_count, int32_t *p_out,
+                                    uint32_t *p_out_count);
+
+/*!
+ * @brief Snapshot of the metrics of a single stage.
+ */
+typedef struct
+{
+    uint64_t items_in;      /* Elements consumed from the input ring. */
+    uint64_t items_out;     /* Elements pushed into the output ring. */
+    uint64_t calls;         /* Invocations of the stage function. */
+    uint64_t in_stalls;     /* Polls that found the input ring empty. */
+    uint64_t out_stalls;    /* Polls blocked by a full output ring. */
+    uint64_t run_ns;        /* Wall time since the stage thread started. */
+    uint32_t in_capacity;   /* Capacity of the input ring (0 for source). */
+    uint32_t in_occupancy;  /* Current number of elements in the input ring. */
+    double in_occupancy_avg; /* Input ring occupancy averaged over reads. */
+} pipeline_stats_t;
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct pipeline_t pipeline_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+pipeline_t* pipeline_create(uint32_t ring_capacity, uint32_t batch_size);
+bool pipeline_add_stage(pipeline_t *p_pl, pipeline_stage_fn_t fn, void *p_ctx,
+                        int cpu);
+bool pipeline_start(pipeline_t *p_pl);
+void pipeline_stop(pipeline_t *p_pl);
+bool pipeline_wait(pipeline_t *p_pl);
+uint32_t pipeline_stage_count(const pipeline_t *p_pl);
+bool pipeline_get_stats(const pipeline_t *p_pl, uint32_t stage,
+                        pipeline_stats_t *p_stats);
+void pipeline_destroy(pipeline_t *p_pl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PIPELINE_H */
+
+/*** End of file: pipeline.h */
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the object pool module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root with:
+ *          $ gcc -O2 -pthread pool.c main.c -o run_pool
+ *
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include "pool.h"
+
+#define CHUNK_OBJS      (64)
+#define OBJ_COUNT       (100)
+#define THREAD_COUNT    (4)
+#define ROUND_COUNT     (1000)
+
+typedef struct
+{
+    int32_t x;
+    int32_t y;
+} point_t;
+
+typedef struct
+{
+    pool_t *p_pool;
+    int32_t id;
+    uint32_t errors;
+} worker_ctx_t;
+
+/* Allocates, fills and checks OBJ_COUNT points per round through a cache. */
+static void* worker(void *p_arg)
+{
+    worker_ctx_t *p_ctx = p_arg;
+    point_t *points[OBJ_COUNT];
+    pool_cache_t *p_cache = pool_cache_create(p_ctx->p_pool);
+
+    for (int32_t round = 0; round < ROUND_COUNT; round++)
+    {
+        for (int32_t i = 0; i < OBJ_COUNT; i++)
+        {
+            points[i] = pool_cache_alloc(p_cache);
+            points[i]->x = p_ctx->id;
+            points[i]->y = i;
+        }
+        for (int32_t i = 0; i < OBJ_COUNT; i++)
+        {
+            if ((points[i]->x != p_ctx->id) || (points[i]->y != i))
+            {
+                p_ctx->errors++;
+            }
+            pool_cache_free(p_cache, points[i]);
+        }
+    }
+
+    pool_cache_destroy(p_cache);
+
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    point_t *points[OBJ_COUNT];
+
+    pool_t *p_pool = pool_create(sizeof(point_t), CHUNK_OBJS);
+    printf("%zu\n", pool_obj_size(p_pool)); /* 8 */
+    printf("%u\n", pool_chunk_count(p_pool)); /* 0 */
+
+    /* Magazines of 32 are loaded from two chunks of 64. */
+    pool_cache_t *p_cache = pool_cache_create(p_pool);
+    for (int32_t i = 0; i < OBJ_COUNT; i++)
+    {
+        points[i] = pool_cache_alloc(p_cache);
+    }
+    printf("%u\n", pool_chunk_count(p_pool)); /* 2 */
+
+    /* Released objects are reused without growing the pool. */
+    for (int32_t i = 0; i < OBJ_COUNT; i++)
+    {
+        pool_cache_free(p_cache, points[i]);
+    }
+    for (int32_t i = 0; i < OBJ_COUNT; i++)
+    {
+        points[i] = pool_cache_alloc(p_cache);
+    }
+    printf("%u\n", pool_chunk_count(p_pool)); /* 2 */
+
+    /* The most recently released object comes back first. */
+    point_t *p_hot = points[0];
+    pool_cache_free(p_cache, p_hot);
+    printf("%d\n", pool_cache_alloc(p_cache) == p_hot); /* 1 */
+
+    /* Objects may be returned without a cache. */
+    for (int32_t i = 0; i < OBJ_COUNT; i++)
+    {
+        pool_free(p_pool, points[i]);
+    }
+    pool_cache_destroy(p_cache);
+
+    /* Each thread uses its own cache on the shared pool. */
+    pthread_t threads[THREAD_COUNT];
+    worker_ctx_t ctx[THREAD_COUNT];
+    uint32_t errors = 0;
+
+    for (int32_t t = 0; t < THREAD_COUNT; t++)
+    {
+        ctx[t].p_pool = p_pool;
+        ctx[t].id = t;
+        ctx[t].errors = 0;
+        pthread_create(&threads[t], NULL, worker, &ctx[t]);
+    }
+    for (int32_t t = 0; t < THREAD_COUNT; t++)
+    {
+        pthread_join(threads[t], NULL);
+        errors += ctx[t].errors;
+    }
+    printf("%u\n", errors); /* 0 */
+
+    pool_destroy(p_pool);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
@@ -0,0 +1,544 @@
+/*******************************************************************************
+ *
+ * @file    pool.c
+ * @brief   Implementation of a fixed-size object pool.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definitions of pool_t, pool_cache_t and pool_obj_t are
+ *          intentionally kept private to this source file to enforce
+ *          encapsulation. Users of this module interact with the pool only
+ *          through the public API and cannot access or modify internal members
+ *          directly.
+ *
+ ******************************************************************************/
+
+#include "pool.h"
+#include <pthread.h>
+#include <stdlib.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define POOL_ALIGN  (_Alignof(max_align_t))
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Header overlaid on an object while it is not in use.
+ * @note A magazine is a chain of objects linked through p_next. Full
+ * magazines in the depot are stacked through p_next_mag of their first
+ * object, so neither needs memory beyond the objects themselves.
+ */
+typedef struct pool_obj_t
+{
+    struct pool_obj_t *p_next;      /* Next object of the same chain. */
+    struct pool_obj_t *p_next_mag;  /* Next full magazine; head object only. */
+} pool_obj_t;
+
+/*!
+ * @brief Header of a chunk, followed by chunk_objs object slots.
+ */
+typedef struct pool_chunk_t
+{
+    struct pool_chunk_t *p_next;
+} pool_chunk_t;
+
+/*!
+ * @brief Chain of up to POOL_MAGAZINE_SIZE objects.
+ */
+typedef struct
+{
+    pool_obj_t *p_head;
+    uint32_t count;
+} pool_mag_t;
+
+/*!
+ * @brief Structure representing an object pool and its depot.
+ * @note This structure is opaque to users of the API. All members below lock
+ * are protected by it.
+ */
+struct pool_t
+{
+    size_t obj_size;            /* Size requested by the user. */
+    size_t slot_size;           /* Object size rounded up to POOL_ALIGN. */
+    uint32_t chunk_objs;
+    pthread_mutex_t lock;
+    pool_obj_t *p_full;         /* Stack of full magazines. */
+    pool_obj_t *p_free;         /* Loose objects. */
+    pool_chunk_t *p_chunks;
+    uint32_t chunk_count;
+    unsigned char *p_carve;     /* Next unused slot of the newest chunk. */
+    uint32_t carve_left;
+};
+
+/*!
+ * @brief Structure representing a per-thread cache of a pool.
+ * @note This structure is opaque to users of the API. The previous magazine is
+ * always either full or empty, so a thread alternating between allocating and
+ * releasing around a magazine boundary does not reach the depot each time.
+ */
+struct pool_cache_t
+{
+    pool_t *p_pool;
+    pool_mag_t loaded;          /* Serves allocations and releases. */
+    pool_mag_t previous;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static pool_obj_t* pool_take_locked(pool_t *p_pool);
+static void pool_fill_locked(pool_t *p_pool, pool_mag_t *p_mag);
+static void pool_put_locked(pool_t *p_pool, pool_mag_t *p_mag);
+static bool pool_grow_locked(pool_t *p_pool);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes an object pool.
+ * @param[in] obj_size Size of each object in bytes.
+ * @param[in] chunk_objs Number of objects obtained from malloc() at a time.
+ * @return Pointer to the created pool, or NULL if either argument is 0, the
+ * chunk size overflows, or memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note Objects are aligned for any type. No memory is reserved for objects
+ * until the first allocation.
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling pool_destroy().
+ */
+pool_t* pool_create(size_t obj_size, uint32_t chunk_objs)
+{
+    if ((0 == obj_size) || (0 == chunk_objs))
+    {
+        return NULL;
+    }
+
+    size_t slot_size = (obj_size < sizeof(pool_obj_t)) ? sizeof(pool_obj_t)
+                                                       : obj_size;
+    if (slot_size > (SIZE_MAX - POOL_ALIGN))
+    {
+        return NULL;
+    }
+    slot_size = (slot_size + POOL_ALIGN - 1U) & ~(POOL_ALIGN - 1U);
+
+    if (slot_size > ((SIZE_MAX - POOL_ALIGN) / chunk_objs))
+    {
+        /* Chunk size overflows. */
+        return NULL;
+    }
+
+    pool_t *p_pool = calloc(1, sizeof(pool_t));
+    if (NULL == p_pool)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    if (0 != pthread_mutex_init(&p_pool->lock, NULL))
+    {
+        free(p_pool);
+        return NULL;
+    }
+
+    p_pool->obj_size = obj_size;
+    p_pool->slot_size = slot_size;
+    p_pool->chunk_objs = chunk_objs;
+
+    return p_pool;
+} /* End of pool_create() */
+
+/*!
+ * @brief Allocates an object from the depot.
+ * @param[in,out] p_pool Pointer to the pool.
+ * @return Pointer to an uninitialized object, or NULL if p_pool is NULL or
+ * memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note Takes the pool lock. Threads that allocate often should use a
+ * pool_cache_t instead.
+ */
+void* pool_alloc(pool_t *p_pool)
+{
+    if (NULL == p_pool)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&p_pool->lock);
+    pool_obj_t *p_obj = pool_take_locked(p_pool);
+    pthread_mutex_unlock(&p_pool->lock);
+
+    return p_obj;
+} /* End of pool_alloc() */
+
+/*!
+ * @brief Returns an object to the depot.
+ * @param[in,out] p_pool Pointer to the pool.
+ * @param[in] p_obj Object allocated from this pool. May be NULL.
+ * @note Time complexity: O(1)
+ * @note Takes the pool lock.
+ */
+void pool_free(pool_t *p_pool, void *p_obj)
+{
+    if ((NULL == p_pool) || (NULL == p_obj))
+    {
+        return;
+    }
+
+    pool_obj_t *p_node = p_obj;
+
+    pthread_mutex_lock(&p_pool->lock);
+    p_node->p_next = p_pool->p_free;
+    p_pool->p_free = p_node;
+    pthread_mutex_unlock(&p_pool->lock);
+} /* End of pool_free() */
+
+/*!
+ * @brief Returns the object size given to pool_create().
+ * @param[in] p_pool Pointer to the pool.
+ * @return Object size in bytes, or 0 if p_pool is NULL.
+ * @note Time complexity: O(1)
+ */
+size_t pool_obj_size(const pool_t *p_pool)
+{
+    if (NULL == p_pool)
+    {
+        return 0;
+    }
+
+    return p_pool->obj_size;
+} /* End of pool_obj_size() */
+
+/*!
+ * @brief Counts the chunks obtained from malloc().
+ * @param[in] p_pool Pointer to the pool.
+ * @return Number of chunks, or 0 if p_pool is NULL.
+ * @note Time complexity: O(1)
+ * @note Takes the pool lock.
+ */
+uint32_t pool_chunk_count(const pool_t *p_pool)
+{
+    if (NULL == p_pool)
+    {
+        return 0;
+    }
+
+    /* Casting away const only permits taking the lock. */
+    pool_t *p_locked = (pool_t *)p_pool;
+
+    pthread_mutex_lock(&p_locked->lock);
+    uint32_t count = p_locked->chunk_count;
+    pthread_mutex_unlock(&p_locked->lock);
+
+    return count;
+} /* End of pool_chunk_count() */
+
+/*!
+ * @brief Destroys a pool and releases all of its chunks.
+ * @param[in] p_pool Pointer to the pool.
+ * @note Time complexity: O(c), where c is the number of chunks.
+ * @note Every cache of the pool must be destroyed first. Objects still in use
+ * become invalid.
+ * @note It is safe to call this function with a NULL pointer.
+ */
+void pool_destroy(pool_t *p_pool)
+{
+    if (NULL == p_pool)
+    {
+        return;
+    }
+
+    pool_chunk_t *p_chunk = p_pool->p_chunks;
+    while (NULL != p_chunk)
+    {
+        pool_chunk_t *p_next = p_chunk->p_next;
+        free(p_chunk);
+        p_chunk = p_next;
+    }
+
+    pthread_mutex_destroy(&p_pool->lock);
+    free(p_pool);
+} /* End of pool_destroy() */
+
+/*!
+ * @brief Creates an empty per-thread cache for a pool.
+ * @param[in] p_pool Pointer to the pool.
+ * @return Pointer to the created cache, or NULL if p_pool is NULL or memory
+ * allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling pool_cache_destroy() before the pool is destroyed.
+ */
+pool_cache_t* pool_cache_create(pool_t *p_pool)
+{
+    if (NULL == p_pool)
+    {
+        return NULL;
+    }
+
+    pool_cache_t *p_cache = calloc(1, sizeof(pool_cache_t));
+    if (NULL == p_cache)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_cache->p_pool = p_pool;
+
+    return p_cache;
+} /* End of pool_cache_create() */
+
+/*!
+ * @brief Allocates an object through a cache.
+ * @param[in,out] p_cache Pointer to the cache.
+ * @return Pointer to an uninitialized object, or NULL if p_cache is NULL or
+ * memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note Takes the pool lock only when both magazines are empty, to load a
+ * full magazine from the depot.
+ */
+void* pool_cache_alloc(pool_cache_t *p_cache)
+{
+    if (NULL == p_cache)
+    {
+        return NULL;
+    }
+
+    pool_mag_t *p_mag = &p_cache->loaded;
+
+    if (0 == p_mag->count)
+    {
+        if (0 != p_cache->previous.count)
+        {
+            /* The previous magazine is full: swap. */
+            *p_mag = p_cache->previous;
+            p_cache->previous.p_head = NULL;
+            p_cache->previous.count = 0;
+        }
+        else
+        {
+            pthread_mutex_lock(&p_cache->p_pool->lock);
+            pool_fill_locked(p_cache->p_pool, p_mag);
+            pthread_mutex_unlock(&p_cache->p_pool->lock);
+
+            if (0 == p_mag->count)
+            {
+                /* Memory allocation failed. */
+                return NULL;
+            }
+        }
+    }
+
+    pool_obj_t *p_obj = p_mag->p_head;
+    p_mag->p_head = p_obj->p_next;
+    p_mag->count--;
+
+    return p_obj;
+} /* End of pool_cache_alloc() */
+
+/*!
+ * @brief Releases an object through a cache.
+ * @param[in,out] p_cache Pointer to the cache.
+ * @param[in] p_obj Object allocated from the pool of the cache. May be NULL.
+ * @note Time complexity: O(1)
+ * @note Takes the pool lock only when both magazines are full, to hand one of
+ * them to the depot.
+ */
+void pool_cache_free(pool_cache_t *p_cache, void *p_obj)
+{
+    if ((NULL == p_cache) || (NULL == p_obj))
+    {
+        return;
+    }
+
+    pool_mag_t *p_mag = &p_cache->loaded;
+
+    if (POOL_MAGAZINE_SIZE == p_mag->count)
+    {
+        if (POOL_MAGAZINE_SIZE == p_cache->previous.count)
+        {
+            pthread_mutex_lock(&p_cache->p_pool->lock);
+            pool_put_locked(p_cache->p_pool, &p_cache->previous);
+            pthread_mutex_unlock(&p_cache->p_pool->lock);
+        }
+
+        /* The previous magazine is empty: swap. */
+        p_cache->previous = *p_mag;
+        p_mag->p_head = NULL;
+        p_mag->count = 0;
+    }
+
+    pool_obj_t *p_node = p_obj;
+    p_node->p_next = p_mag->p_head;
+    p_mag->p_head = p_node;
+    p_mag->count++;
+} /* End of pool_cache_free() */
+
+/*!
+ * @brief Returns every object held by a cache to the depot.
+ * @param[in,out] p_cache Pointer to the cache.
+ * @note Time complexity: O(POOL_MAGAZINE_SIZE)
+ * @note Useful before a thread goes idle, so that other threads can reuse the
+ * objects. If p_cache is NULL, the function does nothing.
+ */
+void pool_cache_flush(pool_cache_t *p_cache)
+{
+    if (NULL == p_cache)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&p_cache->p_pool->lock);
+    pool_put_locked(p_cache->p_pool, &p_cache->loaded);
+    pool_put_locked(p_cache->p_pool, &p_cache->previous);
+    pthread_mutex_unlock(&p_cache->p_pool->lock);
+} /* End of pool_cache_flush() */
+
+/*!
+ * @brief Flushes and destroys a cache.
+ * @param[in] p_cache Pointer to the cache.
+ * @note Time complexity: O(POOL_MAGAZINE_SIZE)
+ * @note It is safe to call this function with a NULL pointer.
+ */
+void pool_cache_destroy(pool_cache_t *p_cache)
+{
+    if (NULL == p_cache)
+    {
+        return;
+    }
+
+    pool_cache_flush(p_cache);
+    free(p_cache);
+} /* End of pool_cache_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Takes one object from the depot.
+ * @param[in,out] p_pool Pointer to the pool, whose lock is held.
+ * @return Pointer to the object, or NULL if memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note Loose objects are used first, then a full magazine is broken up, and
+ * only then is a new slot carved from a chunk.
+ */
+static pool_obj_t* pool_take_locked(pool_t *p_pool)
+{
+    if ((NULL == p_pool->p_free) && (NULL != p_pool->p_full))
+    {
+        /* Break up a full magazine into loose objects. */
+        p_pool->p_free = p_pool->p_full;
+        p_pool->p_full = p_pool->p_full->p_next_mag;
+    }
+
+    pool_obj_t *p_obj = p_pool->p_free;
+    if (NULL != p_obj)
+    {
+        p_pool->p_free = p_obj->p_next;
+        return p_obj;
+    }
+
+    if ((0 == p_pool->carve_left) && !pool_grow_locked(p_pool))
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_obj = (pool_obj_t *)p_pool->p_carve;
+    p_pool->p_carve += p_pool->slot_size;
+    p_pool->carve_left--;
+
+    return p_obj;
+} /* End of pool_take_locked() */
+
+/*!
+ * @brief Loads an empty magazine from the depot.
+ * @param[in,out] p_pool Pointer to the pool, whose lock is held.
+ * @param[in,out] p_mag Empty magazine to load.
+ * @note Time complexity: O(POOL_MAGAZINE_SIZE)
+ * @note A full magazine is taken whole in O(1). Otherwise the magazine is
+ * filled one object at a time, and is left partially filled if memory
+ * allocation fails.
+ */
+static void pool_fill_locked(pool_t *p_pool, pool_mag_t *p_mag)
+{
+    if (NULL != p_pool->p_full)
+    {
+        p_mag->p_head = p_pool->p_full;
+        p_mag->count = POOL_MAGAZINE_SIZE;
+        p_pool->p_full = p_pool->p_full->p_next_mag;
+        return;
+    }
+
+    while (p_mag->count < POOL_MAGAZINE_SIZE)
+    {
+        pool_obj_t *p_obj = pool_take_locked(p_pool);
+        if (NULL == p_obj)
+        {
+            return;
+        }
+
+        p_obj->p_next = p_mag->p_head;
+        p_mag->p_head = p_obj;
+        p_mag->count++;
+    }
+} /* End of pool_fill_locked() */
+
+/*!
+ * @brief Hands the objects of a magazine to the depot and empties it.
+ * @param[in,out] p_pool Pointer to the pool, whose lock is held.
+ * @param[in,out] p_mag Magazine to empty.
+ * @note Time complexity: O(1) for a full magazine, which is stacked whole;
+ * O(POOL_MAGAZINE_SIZE) otherwise.
+ */
+static void pool_put_locked(pool_t *p_pool, pool_mag_t *p_mag)
+{
+    if (POOL_MAGAZINE_SIZE == p_mag->count)
+    {
+        p_mag->p_head->p_next_mag = p_pool->p_full;
+        p_pool->p_full = p_mag->p_head;
+    }
+    else
+    {
+        while (NULL != p_mag->p_head)
+        {
+            pool_obj_t *p_obj = p_mag->p_head;
+            p_mag->p_head = p_obj->p_next;
+            p_obj->p_next = p_pool->p_free;
+            p_pool->p_free = p_obj;
+        }
+    }
+
+    p_mag->p_head = NULL;
+    p_mag->count = 0;
+} /* End of pool_put_locked() */
+
+/*!
+ * @brief Obtains a new chunk to carve objects from.
+ * @param[in,out] p_pool Pointer to the pool, whose lock is held.
+ * @return true If a chunk was added.
+ * @return false If memory allocation fails.
+ * @note Time complexity: O(1). Slots are carved lazily, so the chunk is not
+ * touched until its objects are used.
+ */
+static bool pool_grow_locked(pool_t *p_pool)
+{
+    /* Keep the first slot aligned after the header. */
+    size_t header = (sizeof(pool_chunk_t) + POOL_ALIGN - 1U)
+                    & ~(POOL_ALIGN - 1U);
+
+    pool_chunk_t *p_chunk = malloc(header + (p_pool->slot_size
+                                             * p_pool->chunk_objs));
+    if (NULL == p_chunk)
+    {
+        /* Memory allocation failed. */
+        return false;
+    }
+
+    p_chunk->p_next = p_pool->p_chunks;
+    p_pool->p_chunks = p_chunk;
+    p_pool->chunk_count++;
+
+    p_pool->p_carve = (unsigned char *)p_chunk + header;
+    p_pool->carve_left = p_pool->chunk_objs;
+
+    return true;
+} /* End of pool_grow_locked() */
+
+/*** End of file: pool.c */
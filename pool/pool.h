@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * @file    pool.h
+ * @brief   Public APIs for a fixed-size object pool.
+ * @details This module hands out objects of a single size carved from large
+ *          chunks (slabs) and keeps released objects in LIFO free lists
+ *          chained through the objects themselves, like slist_node_t. Each
+ *          thread may add a cache (pool_cache_t) holding up to two magazines
+ *          of POOL_MAGAZINE_SIZE objects; the cache serves allocations and
+ *          releases without locking and trades whole magazines with a
+ *          mutex-protected depot shared by all threads, so the lock is taken
+ *          at most once per POOL_MAGAZINE_SIZE operations and recently
+ *          released (cache-hot) objects are reused first.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    pool_alloc() and pool_free() may be called from any thread. A
+ *          pool_cache_t must only be used by one thread at a time. Objects
+ *          may be released through any cache of the pool, or pool_free(),
+ *          regardless of where they were allocated. Build with -pthread.
+ *
+ ******************************************************************************/
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+#define POOL_MAGAZINE_SIZE  (32U)   /* Objects exchanged with the depot. */
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct pool_t pool_t;
+typedef struct pool_cache_t pool_cache_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+pool_t* pool_create(size_t obj_size, uint32_t chunk_objs);
+void* pool_alloc(pool_t *p_pool);
+void pool_free(pool_t *p_pool, void *p_obj);
+size_t pool_obj_size(const pool_t *p_pool);
+uint32_t pool_chunk_count(const pool_t *p_pool);
+void pool_destroy(pool_t *p_pool);
+
+pool_cache_t* pool_cache_create(pool_t *p_pool);
+void* pool_cache_alloc(pool_cache_t *p_cache);
+void pool_cache_free(pool_cache_t *p_cache, void *p_obj);
+void pool_cache_flush(pool_cache_t *p_cache);
+void pool_cache_destroy(pool_cache_t *p_cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POOL_H */
+
+/*** End of file: pool.h */
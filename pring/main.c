@@ -0,0 +1,81 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the priority ring set module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          pring):
+ *          $ gcc -O2 main.c pring.c ../rbuffer/rbuffer.c -o pring
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "pring.h"
+
+#define CLASS_COUNT (3)
+
+static void dequeue_all(pring_t *p_pr)
+{
+    int32_t data;
+    uint32_t class_id;
+
+    while (pring_dequeue(p_pr, &data, &class_id))
+    {
+        printf("%u:%d ", class_id, data);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const uint32_t capacities[CLASS_COUNT] = { 4, 8, 8 };
+    const uint32_t weights[CLASS_COUNT] = { 1, 2, 1 };
+
+    pring_t *p_pr = pring_create(CLASS_COUNT, capacities, weights,
+                                 PRING_POLICY_STRICT);
+    printf("%d\n", pring_is_empty(p_pr)); /* 1 */
+
+    /* Bulk backlog, then control messages. */
+    for (int32_t i = 0; i < 4; i++)
+    {
+        pring_enqueue(p_pr, 2, 20 + i);
+        pring_enqueue(p_pr, 1, 10 + i);
+    }
+    pring_enqueue(p_pr, 0, 0);
+    pring_enqueue(p_pr, 0, 1);
+    printf("%u %u %u\n", pring_count(p_pr, 0), pring_count(p_pr, 1),
+           pring_count(p_pr, 2)); /* 2 4 4 */
+    printf("%u\n", pring_total_count(p_pr)); /* 10 */
+
+    /* Control messages bypass the backlog. */
+    dequeue_all(p_pr); /* 0:0 0:1 1:10 1:11 1:12 1:13 2:20 2:21 2:22 2:23 */
+
+    /* Weighted sharing: class 1 gets two turns for each one of the others. */
+    pring_set_policy(p_pr, PRING_POLICY_DRR);
+    for (int32_t i = 0; i < 4; i++)
+    {
+        pring_enqueue(p_pr, 2, 20 + i);
+        pring_enqueue(p_pr, 1, 10 + i);
+    }
+    pring_enqueue(p_pr, 0, 0);
+    dequeue_all(p_pr); /* 0:0 1:10 1:11 2:20 1:12 1:13 2:21 2:22 2:23 */
+
+    /* A full class rejects messages instead of overwriting them. */
+    for (int32_t i = 0; i < 5; i++)
+    {
+        pring_enqueue(p_pr, 0, i);
+    }
+    printf("%u/%u\n", pring_count(p_pr, 0), pring_capacity(p_pr, 0)); /* 4/4 */
+    printf("%llu\n",
+           (unsigned long long)pring_drop_count(p_pr, 0)); /* 1 */
+
+    pring_clear(p_pr);
+    printf("%d\n", pring_is_empty(p_pr)); /* 1 */
+
+    pring_destroy(p_pr);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
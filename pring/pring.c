@@ -0,0 +1,384 @@
+/*******************************************************************************
+ *
+ * @file    pring.c
+ * @brief   Implementation of a set of ring buffers with one ring per priority.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definition of pring_t is intentionally kept private to this
+ *          source file to enforce encapsulation. Users of this module interact
+ *          with the set only through the public API and cannot access or
+ *          modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "pring.h"
+#include <stdlib.h>
+#include "../rbuffer/rbuffer.h"
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Structure representing a priority ring set.
+ * @note This structure is opaque to users of the API. Bit i of active is set
+ * if and only if class i has queued messages, so both policies find the next
+ * class with a single bit scan instead of polling every ring. For deficit
+ * round-robin, cur is the class being visited and credit the number of
+ * messages it may still send in this visit. All messages have the same size,
+ * so the deficit a class carries over is always zero: it either uses its
+ * whole weight or empties, which forfeits the rest.
+ */
+struct pring_t
+{
+    rbuffer_t *p_rings[PRING_CLASS_MAX];
+    uint32_t capacities[PRING_CLASS_MAX];
+    uint32_t weights[PRING_CLASS_MAX];
+    uint64_t drops[PRING_CLASS_MAX];
+    uint32_t class_count;
+    uint32_t active;
+    pring_policy_t policy;
+    uint32_t cur;
+    uint32_t credit;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint32_t pring_next_drr_class(const pring_t *p_pr);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates a priority ring set.
+ * @param[in] class_count Number of priority classes, from 1 to
+ * PRING_CLASS_MAX.
+ * @param[in] capacities Array of class_count ring capacities, one per class.
+ * @param[in] weights Array of class_count weights used by deficit
+ * round-robin, each at least 1, or NULL to give every class a weight of 1.
+ * @param[in] policy Initial dequeue policy.
+ * @return Pointer to the created set, or NULL if any argument is invalid or
+ * any memory allocation fails.
+ * @note Time complexity: O(class_count)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling pring_destroy().
+ */
+pring_t* pring_create(uint32_t class_count, const uint32_t capacities[],
+                      const uint32_t weights[], pring_policy_t policy)
+{
+    if ((class_count < 1) || (class_count > PRING_CLASS_MAX) ||
+        (NULL == capacities) ||
+        ((PRING_POLICY_STRICT != policy) && (PRING_POLICY_DRR != policy)))
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < class_count; i++)
+    {
+        if ((0 == capacities[i]) || ((NULL != weights) && (0 == weights[i])))
+        {
+            return NULL;
+        }
+    }
+
+    pring_t *p_pr = malloc(sizeof(pring_t));
+    if (NULL == p_pr)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < class_count; i++)
+    {
+        p_pr->p_rings[i] = rbuffer_create(capacities[i]);
+        if (NULL == p_pr->p_rings[i])
+        {
+            /* Memory allocation failed. */
+            while (i > 0)
+            {
+                rbuffer_destroy(p_pr->p_rings[--i]);
+            }
+            free(p_pr);
+            return NULL;
+        }
+
+        p_pr->capacities[i] = capacities[i];
+        p_pr->weights[i] = (NULL == weights) ? 1U : weights[i];
+        p_pr->drops[i] = 0;
+    }
+
+    p_pr->class_count = class_count;
+    p_pr->active = 0;
+    p_pr->policy = policy;
+    p_pr->cur = class_count - 1U;   /* The first visit goes to class 0. */
+    p_pr->credit = 0;
+
+    return p_pr;
+} /* End of pring_create() */
+
+/*!
+ * @brief Changes the dequeue policy.
+ * @param[in,out] p_pr Pointer to the priority ring set.
+ * @param[in] policy New dequeue policy.
+ * @return true If the policy was changed.
+ * @return false If p_pr is NULL or policy is invalid.
+ * @note Time complexity: O(1)
+ * @note Queued messages are kept. The current deficit round-robin visit ends.
+ */
+bool pring_set_policy(pring_t *p_pr, pring_policy_t policy)
+{
+    if ((NULL == p_pr) ||
+        ((PRING_POLICY_STRICT != policy) && (PRING_POLICY_DRR != policy)))
+    {
+        return false;
+    }
+
+    p_pr->policy = policy;
+    p_pr->credit = 0;
+
+    return true;
+} /* End of pring_set_policy() */
+
+/*!
+ * @brief Queues a message in a priority class.
+ * @param[in,out] p_pr Pointer to the priority ring set.
+ * @param[in] class_id Priority class of the message (0 is the highest).
+ * @param[in] data Message to queue.
+ * @return true If the message was queued.
+ * @return false If p_pr is NULL, class_id is out of range, or the class is
+ * full. A message rejected because its class is full is counted by
+ * pring_drop_count().
+ * @note Time complexity: O(1)
+ */
+bool pring_enqueue(pring_t *p_pr, uint32_t class_id, int32_t data)
+{
+    if ((NULL == p_pr) || (class_id >= p_pr->class_count))
+    {
+        return false;
+    }
+
+    rbuffer_t *p_rb = p_pr->p_rings[class_id];
+    if (rbuffer_is_full(p_rb))
+    {
+        /* Never overwrite: the oldest message may be the one waited for. */
+        p_pr->drops[class_id]++;
+        return false;
+    }
+
+    (void)rbuffer_write(p_rb, data);
+    p_pr->active |= (1U << class_id);
+
+    return true;
+} /* End of pring_enqueue() */
+
+/*!
+ * @brief Removes the next message according to the dequeue policy.
+ * @param[in,out] p_pr Pointer to the priority ring set.
+ * @param[out] p_data Pointer to variable that receives the message.
+ * @param[out] p_class_id Pointer to variable that receives the class of the
+ * message. It may be NULL.
+ * @return true If a message was removed.
+ * @return false If the set is empty, or p_pr or p_data is NULL.
+ * @note Time complexity: O(1)
+ * @note Messages of one class always leave in the order they were queued.
+ */
+bool pring_dequeue(pring_t *p_pr, int32_t *p_data, uint32_t *p_class_id)
+{
+    if ((NULL == p_pr) || (NULL == p_data) || (0 == p_pr->active))
+    {
+        return false;
+    }
+
+    uint32_t class_id;
+
+    if (PRING_POLICY_STRICT == p_pr->policy)
+    {
+        class_id = (uint32_t)__builtin_ctz(p_pr->active);
+    }
+    else
+    {
+        if ((0 == p_pr->credit) || (0 == (p_pr->active & (1U << p_pr->cur))))
+        {
+            /* Start the visit of the next class with data. */
+            p_pr->cur = pring_next_drr_class(p_pr);
+            p_pr->credit = p_pr->weights[p_pr->cur];
+        }
+        class_id = p_pr->cur;
+        p_pr->credit--;
+    }
+
+    rbuffer_t *p_rb = p_pr->p_rings[class_id];
+    (void)rbuffer_read(p_rb, p_data);
+    if (rbuffer_is_empty(p_rb))
+    {
+        p_pr->active &= ~(1U << class_id);
+        if (class_id == p_pr->cur)
+        {
+            /* An emptied class forfeits the rest of its visit. */
+            p_pr->credit = 0;
+        }
+    }
+
+    if (NULL != p_class_id)
+    {
+        *p_class_id = class_id;
+    }
+
+    return true;
+} /* End of pring_dequeue() */
+
+/*!
+ * @brief Returns the number of messages queued in a priority class.
+ * @param[in] p_pr Pointer to the priority ring set.
+ * @param[in] class_id Priority class.
+ * @return Number of queued messages. Returns 0 if p_pr is NULL or class_id is
+ * out of range.
+ * @note Time complexity: O(1)
+ */
+uint32_t pring_count(const pring_t *p_pr, uint32_t class_id)
+{
+    if ((NULL == p_pr) || (class_id >= p_pr->class_count))
+    {
+        return 0;
+    }
+
+    return rbuffer_data_count(p_pr->p_rings[class_id]);
+} /* End of pring_count() */
+
+/*!
+ * @brief Returns the capacity of a priority class.
+ * @param[in] p_pr Pointer to the priority ring set.
+ * @param[in] class_id Priority class.
+ * @return Maximum number of messages the class can hold. Returns 0 if p_pr is
+ * NULL or class_id is out of range.
+ * @note Time complexity: O(1)
+ */
+uint32_t pring_capacity(const pring_t *p_pr, uint32_t class_id)
+{
+    if ((NULL == p_pr) || (class_id >= p_pr->class_count))
+    {
+        return 0;
+    }
+
+    return p_pr->capacities[class_id];
+} /* End of pring_capacity() */
+
+/*!
+ * @brief Returns the number of messages rejected because their class was
+ * full.
+ * @param[in] p_pr Pointer to the priority ring set.
+ * @param[in] class_id Priority class.
+ * @return Number of dropped messages since creation. Returns 0 if p_pr is NULL
+ * or class_id is out of range.
+ * @note Time complexity: O(1)
+ */
+uint64_t pring_drop_count(const pring_t *p_pr, uint32_t class_id)
+{
+    if ((NULL == p_pr) || (class_id >= p_pr->class_count))
+    {
+        return 0;
+    }
+
+    return p_pr->drops[class_id];
+} /* End of pring_drop_count() */
+
+/*!
+ * @brief Returns the number of messages queued in all classes.
+ * @param[in] p_pr Pointer to the priority ring set.
+ * @return Number of queued messages. Returns 0 if p_pr is NULL.
+ * @note Time complexity: O(number of classes)
+ */
+uint32_t pring_total_count(const pring_t *p_pr)
+{
+    if (NULL == p_pr)
+    {
+        return 0;
+    }
+
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < p_pr->class_count; i++)
+    {
+        total += rbuffer_data_count(p_pr->p_rings[i]);
+    }
+
+    return total;
+} /* End of pring_total_count() */
+
+/*!
+ * @brief Checks whether no message is queued in any class.
+ * @param[in] p_pr Pointer to the priority ring set.
+ * @return true If the set is empty or p_pr is NULL.
+ * @return false Otherwise.
+ * @note Time complexity: O(1)
+ */
+bool pring_is_empty(const pring_t *p_pr)
+{
+    if (NULL == p_pr)
+    {
+        return true;
+    }
+
+    return (0 == p_pr->active);
+} /* End of pring_is_empty() */
+
+/*!
+ * @brief Removes all queued messages. Drop counts are kept.
+ * @param[in,out] p_pr Pointer to the priority ring set.
+ * @note Time complexity: O(number of classes)
+ */
+void pring_clear(pring_t *p_pr)
+{
+    if (NULL == p_pr)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < p_pr->class_count; i++)
+    {
+        rbuffer_clear(p_pr->p_rings[i]);
+    }
+
+    p_pr->active = 0;
+    p_pr->credit = 0;
+} /* End of pring_clear() */
+
+/*!
+ * @brief Destroys a priority ring set and frees all of its resources.
+ * @param[in] p_pr Pointer to the priority ring set.
+ * @note Time complexity: O(number of classes)
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void pring_destroy(pring_t *p_pr)
+{
+    if (NULL == p_pr)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < p_pr->class_count; i++)
+    {
+        rbuffer_destroy(p_pr->p_rings[i]);
+    }
+
+    free(p_pr);
+} /* End of pring_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Finds the class visited after cur by deficit round-robin.
+ * @param[in] p_pr Pointer to the priority ring set, which must not be empty.
+ * @return First class with data after cur, wrapping around to cur itself.
+ */
+static uint32_t pring_next_drr_class(const pring_t *p_pr)
+{
+    /* cur is below PRING_CLASS_MAX, so the shift cannot overflow. */
+    uint32_t after = p_pr->active & ~((2U << p_pr->cur) - 1U);
+
+    if (0 != after)
+    {
+        return (uint32_t)__builtin_ctz(after);
+    }
+
+    return (uint32_t)__builtin_ctz(p_pr->active);
+} /* End of pring_next_drr_class() */
+
+/*** End of file: pring.c */
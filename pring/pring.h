@@ -0,0 +1,73 @@
+/*******************************************************************************
+ *
+ * @file    pring.h
+ * @brief   Public APIs for a set of ring buffers with one ring per priority.
+ * @details This module queues int32_t messages in one ring buffer (rbuffer_t)
+ *          per priority class, so that a backlog in one class never delays
+ *          the messages of another. Class 0 has the highest priority. The
+ *          next message is chosen by one of two policies:
+ *          - Strict priority: always from the highest-priority non-empty
+ *            class. Lower classes can starve while higher ones have data.
+ *          - Deficit round-robin: non-empty classes are visited in turn, and
+ *            each may send up to its weight in messages per visit, so every
+ *            class gets a share of the output proportional to its weight.
+ *          Users must interact with the set only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Unlike rbuffer_write(), pring_enqueue() never overwrites queued
+ *          messages: a message for a full class is rejected and counted as a
+ *          drop. Build together with ../rbuffer/rbuffer.c.
+ *
+ ******************************************************************************/
+
+#ifndef PRING_H
+#define PRING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+#define PRING_CLASS_MAX     (8U)
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct pring_t pring_t;
+
+/* Public data types ---------------------------------------------------------*/
+
+/*!
+ * @brief Policies choosing the class of the next dequeued message.
+ */
+typedef enum
+{
+    PRING_POLICY_STRICT,    /* Highest-priority non-empty class first. */
+    PRING_POLICY_DRR        /* Deficit round-robin by class weight. */
+} pring_policy_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+pring_t* pring_create(uint32_t class_count, const uint32_t capacities[],
+                      const uint32_t weights[], pring_policy_t policy);
+bool pring_set_policy(pring_t *p_pr, pring_policy_t policy);
+bool pring_enqueue(pring_t *p_pr, uint32_t class_id, int32_t data);
+bool pring_dequeue(pring_t *p_pr, int32_t *p_data, uint32_t *p_class_id);
+uint32_t pring_count(const pring_t *p_pr, uint32_t class_id);
+uint32_t pring_capacity(const pring_t *p_pr, uint32_t class_id);
+uint64_t pring_drop_count(const pring_t *p_pr, uint32_t class_id);
+uint32_t pring_total_count(const pring_t *p_pr);
+bool pring_is_empty(const pring_t *p_pr);
+void pring_clear(pring_t *p_pr);
+void pring_destroy(pring_t *p_pr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRING_H */
+
+/*** End of file: pring.h */
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ *
+ * @file    bench_coro.cpp
+ * @brief   Benchmark of coroutine awaitables versus polling the ring buffer.
+ * @details A producer and a consumer exchange ITEM_COUNT elements through a
+ *          ring on a single thread, once as two coroutines awaiting
+ *          dsa::coro_ring and once as a loop polling rbuffer_write() and
+ *          rbuffer_read() until the ring is full or empty.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          rbuffer):
+ *          $ gcc -O2 -c rbuffer.c -o rbuffer.o
+ *          $ g++ -std=c++20 -O2 -I. bench/bench_coro.cpp rbuffer.o -o bench_coro
+ *
+ ******************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include "rbuffer.h"
+#include "rbuffer_coro.hpp"
+
+#define ITEM_COUNT  (10000000)
+
+static const std::uint32_t g_capacities[] = { 16, 256, 4096 };
+
+static dsa::coro_task producer(dsa::coro_ring &ring, std::int32_t count)
+{
+    for (std::int32_t i = 0; i < count; i++)
+    {
+        co_await ring.write(i);
+    }
+}
+
+static dsa::coro_task consumer(dsa::coro_ring &ring, std::int32_t count,
+                               std::int64_t &sum)
+{
+    for (std::int32_t i = 0; i < count; i++)
+    {
+        sum += co_await ring.read();
+    }
+}
+
+static double bench_coroutine(std::uint32_t capacity, std::int64_t &sum)
+{
+    dsa::coro_executor executor;
+    dsa::coro_ring ring(executor, capacity);
+
+    auto start = std::chrono::steady_clock::now();
+    executor.spawn(consumer(ring, ITEM_COUNT, sum));
+    executor.spawn(producer(ring, ITEM_COUNT));
+    executor.run();
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+static double bench_polling(std::uint32_t capacity, std::int64_t &sum)
+{
+    rbuffer_t *p_rb = rbuffer_create(capacity);
+    std::int32_t next = 0;
+    std::int32_t consumed = 0;
+    std::int32_t data;
+
+    auto start = std::chrono::steady_clock::now();
+    while (consumed < ITEM_COUNT)
+    {
+        /* Producer: fill until full. */
+        while ((next < ITEM_COUNT) && !rbuffer_is_full(p_rb))
+        {
+            rbuffer_write(p_rb, next++);
+        }
+
+        /* Consumer: poll until empty. */
+        while (rbuffer_read(p_rb, &data))
+        {
+            sum += data;
+            consumed++;
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    rbuffer_destroy(p_rb);
+
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main()
+{
+    printf("%-10s %14s %14s\n", "capacity", "coro (ns/op)", "poll (ns/op)");
+
+    for (std::uint32_t capacity : g_capacities)
+    {
+        std::int64_t coro_sum = 0;
+        std::int64_t poll_sum = 0;
+        double coro_s = bench_coroutine(capacity, coro_sum);
+        double poll_s = bench_polling(capacity, poll_sum);
+
+        if (coro_sum != poll_sum)
+        {
+            printf("Error: checksum mismatch (%lld != %lld)\n",
+                   (long long)coro_sum, (long long)poll_sum);
+            return 1;
+        }
+
+        printf("%-10u %14.2f %14.2f\n", capacity,
+               coro_s * 1e9 / ITEM_COUNT, poll_s * 1e9 / ITEM_COUNT);
+    }
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: bench_coro.cpp ***/
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * @file    bench_inline.c
+ * @brief   Benchmark of the checked ring buffer APIs versus the inline fast
+ *          paths of rbuffer_inline.h.
+ * @details ITEM_COUNT elements are streamed through a ring in bursts of half
+ *          its capacity, once with rbuffer_write() / rbuffer_read() and once
+ *          with rbuffer_write_fast() / rbuffer_read_fast().
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          rbuffer):
+ *          $ gcc -O2 -DRBUFFER_INLINE -I. rbuffer.c bench/bench_inline.c \
+ *                -o bench_inline
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+#include "rbuffer.h"
+
+#ifndef RBUFFER_INLINE
+#error "Build with -DRBUFFER_INLINE."
+#endif
+
+#define ITEM_COUNT      (100000000)
+#define RING_CAPACITY   (256)
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static double bench_checked(rbuffer_t *p_rb, int64_t *p_sum)
+{
+    int32_t data;
+    double start = now_s();
+
+    for (int32_t i = 0; i < ITEM_COUNT; i += RING_CAPACITY / 2)
+    {
+        for (int32_t j = 0; j < RING_CAPACITY / 2; j++)
+        {
+            rbuffer_write(p_rb, i + j);
+        }
+        while (rbuffer_read(p_rb, &data))
+        {
+            *p_sum += data;
+        }
+    }
+
+    return (now_s() - start) * 1e9 / ITEM_COUNT;
+}
+
+static double bench_fast(rbuffer_t *p_rb, int64_t *p_sum)
+{
+    int32_t data;
+    double start = now_s();
+
+    for (int32_t i = 0; i < ITEM_COUNT; i += RING_CAPACITY / 2)
+    {
+        for (int32_t j = 0; j < RING_CAPACITY / 2; j++)
+        {
+            rbuffer_write_fast(p_rb, i + j);
+        }
+        while (rbuffer_read_fast(p_rb, &data))
+        {
+            *p_sum += data;
+        }
+    }
+
+    return (now_s() - start) * 1e9 / ITEM_COUNT;
+}
+
+int main(void)
+{
+    rbuffer_t *p_rb = rbuffer_create(RING_CAPACITY);
+    int64_t checked_sum = 0;
+    int64_t fast_sum = 0;
+
+    if (NULL == p_rb)
+    {
+        return 1;
+    }
+
+    double checked_ns = bench_checked(p_rb, &checked_sum);
+    double fast_ns = bench_fast(p_rb, &fast_sum);
+    rbuffer_destroy(p_rb);
+
+    if (checked_sum != fast_sum)
+    {
+        printf("Error: checksum mismatch (%lld != %lld)\n",
+               (long long)checked_sum, (long long)fast_sum);
+        return 1;
+    }
+
+    printf("%-10s %10s\n", "api", "ns/op");
+    printf("%-10s %10.2f\n", "checked", checked_ns);
+    printf("%-10s %10.2f\n", "inline", fast_ns);
+    printf("speedup    %9.2fx\n", checked_ns / fast_ns);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: bench_inline.c ***/
@@ -80,6 +80,31 @@ int main(int argc, char *argv[])
     /* Free. */
     rbuffer_destroy(rb);
 
+    /* Allocation-free ring buffer in caller-provided memory. */
+    static rbuffer_storage_t storage;
+    static int32_t buf[BUFFER_SIZE];
+    rb = rbuffer_init(&storage, buf, BUFFER_SIZE);
+    rbuffer_write(rb, 10);
+    rbuffer_write(rb, 20);
+    rbuffer_display(rb); /* 10 20 */
+    printf("%d\n", buf[1]); /* 20 */
+
+    /* Non-destructive access by position and to the latest data. */
+    int32_t latest[4];
+    for (int i = 30; i <= 100; i += 10)
+    {
+        rbuffer_write(rb, i);
+    }
+    rbuffer_at(rb, 0, &data);
+    printf("%d\n", data); /* 30 */
+    uint32_t n = rbuffer_peek_latest(rb, latest, 4);
+    printf("%u: %d %d %d %d\n", n, latest[0], latest[1], latest[2],
+           latest[3]); /* 4: 70 80 90 100 */
+    n = rbuffer_copy_range(rb, 6, latest, 4);
+    printf("%u: %d %d\n", n, latest[0], latest[1]); /* 2: 90 100 */
+    printf("%d\n", rbuffer_data_count(rb)); /* 8 */
+    rbuffer_destroy(rb); /* Nothing to free. */
+
     return 0;
 } /* End of main() */
 
@@ -5,35 +5,99 @@
  * @author  Kyungjae Lee
  * @date    Feb 07, 2026
  * @note    The definitions of rbuffer_t is intentionally kept private to this
- *          source file to enforce encapsulation. Users of this module interact
- *          with the list only through the public API and cannot access or
- *          modify internal members directly.
+ *          module (see rbuffer_inline.h) to enforce encapsulation. Users of
+ *          this module interact with the list only through the public API and
+ *          cannot access or modify internal members directly.
  * 
  ******************************************************************************/
 
 #include "rbuffer.h"
+#include "rbuffer_inline.h"
 #include "string.h"
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
 /* Macros --------------------------------------------------------------------*/
 
+#define RBUFFER_FILE_MAGIC      (0x46554252U)   /* "RBUF" in little endian. */
+#define RBUFFER_FILE_VERSION    (2U)
+#define RBUFFER_DUMP_CHUNK      (65536U)    /* Bytes per write() call. */
+#define RBUFFER_INT_CHARS       (11U)       /* Longest int32_t, with sign. */
+
 /* Private data types --------------------------------------------------------*/
 
 /*!
- * @brief Structure representing a ring buffer.
- * @note This structure is opaque to users of the API. The full definition is
- * hidden to prevent direct access to internal members and to preserve list
- * invariants.
+ * @brief Header of a checkpoint written by rbuffer_checkpoint().
+ * @note The header is followed by the stored data, oldest first, in host byte
+ * order, and then by the wpart bytes already filled into the free slot at
+ * widx. The indices and the partial-element offsets are saved so a restored
+ * buffer is laid out exactly like the original one, even when a transfer to
+ * or from an fd stopped mid-element.
  */
-struct rbuffer_t
+typedef struct
 {
-    int32_t *p_buf;
+    uint32_t magic;
+    uint16_t version;
+    uint16_t elem_size;
     uint32_t capacity;
-    uint32_t ridx;   /* Read index. */
-    uint32_t widx;   /* Write index. */
-    bool b_is_full;
-};
+    uint32_t ridx;
+    uint32_t widx;
+    uint32_t b_is_full;
+    uint32_t rpart;
+    uint32_t wpart;
+} rbuffer_file_header_t;
+
+_Static_assert(sizeof(rbuffer_t) <= sizeof(rbuffer_storage_t),
+               "RBUFFER_STORAGE_SIZE is too small for rbuffer_t");
+
+/*!
+ * @brief Output state of rbuffer_dump() and rbuffer_dump_fd().
+ * @note With fd < 0 the output goes to the caller's buffer and whatever does
+ * not fit is only counted; otherwise p_buf stages a chunk for write().
+ */
+typedef struct
+{
+    char *p_buf;
+    size_t size;
+    size_t len;     /* Bytes stored in p_buf. */
+    size_t total;   /* Bytes produced so far. */
+    int fd;
+    bool b_error;
+} rbuffer_dump_ctx_t;
+
+/* Private data -------------------------------------------------------------*/
+
+/* Link-time marker of the RBUFFER_SNAPSHOT setting; see rbuffer_inline.h. */
+#ifdef RBUFFER_SNAPSHOT
+const char rbuffer_abi_snapshot = 1;
+#else
+const char rbuffer_abi_plain = 0;
+#endif
+
+/* "00" to "99", indexed by twice the value. */
+static const char g_digit_pairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* Private function prototypes -----------------------------------------------*/
+
+static int rbuffer_data_segments(const rbuffer_t *p_rb, struct iovec *p_iov);
+static int rbuffer_free_segments(const rbuffer_t *p_rb, struct iovec *p_iov);
+static bool rbuffer_transfer_all(int fd, struct iovec *p_iov, int iov_count,
+                                 bool b_write);
+static void rbuffer_dump_all(const rbuffer_t *p_rb,
+                             rbuffer_dump_format_t format,
+                             rbuffer_dump_ctx_t *p_ctx);
+static void rbuffer_dump_emit(rbuffer_dump_ctx_t *p_ctx, const void *p_src,
+                              size_t len);
+static void rbuffer_dump_flush(rbuffer_dump_ctx_t *p_ctx);
+static size_t rbuffer_format_int(int32_t value, char *p_out);
 
 /* Public API definitions ----------------------------------------------------*/
 
@@ -71,11 +135,51 @@ rbuffer_t* rbuffer_create(uint32_t capacity)
     p_rb->capacity = capacity;
     p_rb->ridx = 0;
     p_rb->widx = 0;
+    p_rb->rpart = 0;
+    p_rb->wpart = 0;
     p_rb->b_is_full = false;
+    p_rb->b_is_static = false;
+    p_rb->seq = 0;
 
     return p_rb;
 } /* End of rbuffer_create() */
 
+/*!
+ * @brief Initializes a ring buffer in caller-provided memory.
+ * @param[out] p_storage Memory for the control structure, e.g., a static or
+ * stack variable.
+ * @param[in] p_buf Array of at least capacity elements that holds the data.
+ * @param[in] capacity Maximum number of elements the ring buffer can store.
+ * @return Pointer to the ring buffer control structure, which lives inside
+ * p_storage, or NULL if p_storage or p_buf is NULL or capacity is less than 1.
+ * @note Time complexity: O(1)
+ * @note No memory is allocated, so the buffer can be set up and used from
+ * threads that must not call malloc(). Both p_storage and p_buf must outlive
+ * the ring buffer; rbuffer_destroy() does not free them.
+ */
+rbuffer_t* rbuffer_init(rbuffer_storage_t *p_storage, int32_t *p_buf,
+                        uint32_t capacity)
+{
+    if (NULL == p_storage || NULL == p_buf || capacity < 1)
+    {
+        return NULL;
+    }
+
+    rbuffer_t *p_rb = (rbuffer_t *)p_storage;
+
+    p_rb->p_buf = p_buf;
+    p_rb->capacity = capacity;
+    p_rb->ridx = 0;
+    p_rb->widx = 0;
+    p_rb->rpart = 0;
+    p_rb->wpart = 0;
+    p_rb->b_is_full = false;
+    p_rb->b_is_static = true;
+    p_rb->seq = 0;
+
+    return p_rb;
+} /* End of rbuffer_init() */
+
 /*!
  * @brief Reads and removes oldest data from the ring buffer.
  * @param[in,out] p_rb Pointer to ring buffer control structure.
@@ -100,18 +204,20 @@ bool rbuffer_read(rbuffer_t *p_rb, int32_t *p_data)
     /* Read oldest data. */
     *p_data = p_rb->p_buf[p_rb->ridx];
 
-    /* Advance read index. */
-    p_rb->ridx++;
-    if (p_rb->ridx >= p_rb->capacity)
+    /* Advance read index, dropping any partially drained bytes. */
+    uint32_t ridx = p_rb->ridx + 1U;
+    if (ridx >= p_rb->capacity)
     {
-        p_rb->ridx = 0;
+        ridx = 0;
     }
 
-    /* Update full flag if the buffer is empty now. */
-    if (p_rb->ridx == p_rb->widx)
-    {
-        p_rb->b_is_full = false;
-    }
+    uint32_t seq = rbuffer_seq_begin(p_rb);
+    p_rb->rpart = 0;
+    rbuffer_store_ridx(p_rb, ridx);
+
+    /* A slot has been freed, so the buffer cannot be full anymore. */
+    rbuffer_store_full(p_rb, false);
+    rbuffer_seq_end(p_rb, seq);
 
     return true;
 } /* End of rbuffer_read() */
@@ -132,32 +238,42 @@ bool rbuffer_write(rbuffer_t *p_rb, int32_t data)
         return false;
     }
 
+    uint32_t seq = rbuffer_seq_begin(p_rb);
+    uint32_t ridx = p_rb->ridx;
+    uint32_t widx = p_rb->widx;
+
     if (p_rb->b_is_full)
     {
         /* Buffer full: advance read index to overwrite oldest data. */
-        p_rb->ridx++;
-        if (p_rb->ridx >= p_rb->capacity)
+        p_rb->rpart = 0;
+        ridx++;
+        if (ridx >= p_rb->capacity)
         {
-            p_rb->ridx = 0;
+            ridx = 0;
         }
+        rbuffer_store_ridx(p_rb, ridx);
     }
 
-    /* Write new data. */
-    p_rb->p_buf[p_rb->widx] = data;
+    /* Write new data, replacing any partially filled bytes. */
+    p_rb->p_buf[widx] = data;
+    p_rb->wpart = 0;
 
     /* Advance write index. */
-    p_rb->widx++;
-    if (p_rb->widx >= p_rb->capacity)
+    widx++;
+    if (widx >= p_rb->capacity)
     {
-        p_rb->widx = 0;
+        widx = 0;
     }
+    rbuffer_store_widx(p_rb, widx);
 
     /* Update full flag if the buffer is full now. */
-    if (p_rb->widx == p_rb->ridx)
+    if (widx == ridx)
     {
-        p_rb->b_is_full = true;
+        rbuffer_store_full(p_rb, true);
     }
 
+    rbuffer_seq_end(p_rb, seq);
+
     return true;
 } /* End of rbuffer_write() */
 
@@ -266,13 +382,19 @@ bool rbuffer_clear(rbuffer_t *p_rb)
         return false;
     }
 
+    uint32_t seq = rbuffer_seq_begin(p_rb);
+
     /* Clear the buffer. */
-    memset(p_rb->p_buf, 0, p_rb->capacity);
+    memset(p_rb->p_buf, 0, p_rb->capacity * sizeof(int32_t));
 
     /* Reset the member variables to empty state. */
-    p_rb->widx = 0;
-    p_rb->ridx = 0;
-    p_rb->b_is_full = false;
+    rbuffer_store_widx(p_rb, 0);
+    rbuffer_store_ridx(p_rb, 0);
+    p_rb->rpart = 0;
+    p_rb->wpart = 0;
+    rbuffer_store_full(p_rb, false);
+
+    rbuffer_seq_end(p_rb, seq);
 
     return true;
 } /* End of rbuffer_clear() */
@@ -284,6 +406,7 @@ bool rbuffer_clear(rbuffer_t *p_rb)
  * @note Time complexity: O(1)
  * @note It is safe to call this function with a NULL pointer.
  * @note After this function returns, the pointer must not be used gain.
+ * @note For a buffer set up by rbuffer_init(), nothing is freed.
  */
 void rbuffer_destroy(rbuffer_t *p_rb)
 {
@@ -292,6 +415,12 @@ void rbuffer_destroy(rbuffer_t *p_rb)
         return;
     }
 
+    if (p_rb->b_is_static)
+    {
+        /* Memory belongs to the caller of rbuffer_init(). */
+        return;
+    }
+
     free(p_rb->p_buf);
     free(p_rb);
 } /* End of rbuffer_destroy() */
@@ -334,5 +463,894 @@ void rbuffer_display(const rbuffer_t *p_rb)
     printf("\n");
 } /* End of rbuffer_display() */
 
+/*!
+ * @brief Reads data from a file descriptor directly into the free space of the
+ * ring buffer.
+ * @param[in,out] p_rb Pointer to the ring buffer control structure.
+ * @param[in] fd File descriptor to read from.
+ * @return Number of bytes read, 0 on end of file, or -1 on error with errno
+ * set. errno is EINVAL if p_rb is NULL, and ENOBUFS if the buffer is full.
+ * @note Time complexity: O(1) calls; a single readv() into the (up to two)
+ * free segments of the buffer, with no intermediate copy.
+ * @note The fd is treated as a stream of int32_t in host byte order. Never
+ * overwrites unread data. If the read ends in the middle of an element, its
+ * bytes are kept and the element becomes readable once the next call
+ * completes it; a rbuffer_write() or rbuffer_clear() in between discards them.
+ */
+ssize_t rbuffer_fill_from_fd(rbuffer_t *p_rb, int fd)
+{
+    if (NULL == p_rb)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    struct iovec iov[2];
+    int iov_count = rbuffer_free_segments(p_rb, iov);
+    if (0 == iov_count)
+    {
+        /* No room to read into. */
+        errno = ENOBUFS;
+        return -1;
+    }
+
+    ssize_t n = readv(fd, iov, iov_count);
+    if (n <= 0)
+    {
+        return n;
+    }
+
+    /* Publish whole elements; keep the bytes of a trailing partial one. */
+    uint32_t bytes = p_rb->wpart + (uint32_t)n;
+    uint32_t count = bytes / sizeof(int32_t);
+    p_rb->wpart = bytes % sizeof(int32_t);
+
+    if (count > 0)
+    {
+        /* readv() only wrote free slots; publishing them needs the seq. */
+        uint32_t widx = p_rb->widx + count;
+        if (widx >= p_rb->capacity)
+        {
+            widx -= p_rb->capacity;
+        }
+
+        uint32_t seq = rbuffer_seq_begin(p_rb);
+        rbuffer_store_widx(p_rb, widx);
+        if (widx == p_rb->ridx)
+        {
+            rbuffer_store_full(p_rb, true);
+        }
+        rbuffer_seq_end(p_rb, seq);
+    }
+
+    return n;
+} /* End of rbuffer_fill_from_fd() */
+
+/*!
+ * @brief Writes the data in the ring buffer directly to a file descriptor and
+ * removes what was written.
+ * @param[in,out] p_rb Pointer to the ring buffer control structure.
+ * @param[in] fd File descriptor to write to.
+ * @return Number of bytes written, 0 if the buffer is empty, or -1 on error
+ * with errno set. errno is EINVAL if p_rb is NULL.
+ * @note Time complexity: O(1) calls; a single writev() from the (up to two)
+ * filled segments of the buffer, with no intermediate copy.
+ * @note On a short write that ends in the middle of an element, the element
+ * stays in the buffer and the next call resumes at the first unwritten byte.
+ */
+ssize_t rbuffer_drain_to_fd(rbuffer_t *p_rb, int fd)
+{
+    if (NULL == p_rb)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    struct iovec iov[2];
+    int iov_count = rbuffer_data_segments(p_rb, iov);
+    if (0 == iov_count)
+    {
+        /* Nothing to write. */
+        return 0;
+    }
+
+    ssize_t n = writev(fd, iov, iov_count);
+    if (n <= 0)
+    {
+        return n;
+    }
+
+    /* Remove whole elements; remember how far into the next one we got. */
+    uint32_t bytes = p_rb->rpart + (uint32_t)n;
+    uint32_t count = bytes / sizeof(int32_t);
+    p_rb->rpart = bytes % sizeof(int32_t);
+
+    if (count > 0)
+    {
+        uint32_t ridx = p_rb->ridx + count;
+        if (ridx >= p_rb->capacity)
+        {
+            ridx -= p_rb->capacity;
+        }
+
+        uint32_t seq = rbuffer_seq_begin(p_rb);
+        rbuffer_store_ridx(p_rb, ridx);
+        rbuffer_store_full(p_rb, false);
+        rbuffer_seq_end(p_rb, seq);
+    }
+
+    return n;
+} /* End of rbuffer_drain_to_fd() */
+
+/*!
+ * @brief Describes the stored data, without removing it, as at most two
+ * contiguous segments.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] offset Number of oldest elements to skip.
+ * @param[out] p_segs Array of two segments receiving the data, oldest first.
+ * @return Number of segments filled (0, 1 or 2). Returns 0 if p_rb or p_segs is
+ * NULL, or if offset is not less than the number of stored data.
+ * @note Time complexity: O(1)
+ * @note The segments point into the buffer and stay valid until the data is
+ * read, overwritten or cleared. Together with rbuffer_discard() this lets a
+ * consumer hand the data to another API (e.g., asynchronous I/O) in place.
+ */
+uint32_t rbuffer_peek_segments(const rbuffer_t *p_rb, uint32_t offset,
+                               rbuffer_segment_t *p_segs)
+{
+    if (NULL == p_rb || NULL == p_segs)
+    {
+        return 0;
+    }
+
+    uint32_t count = rbuffer_data_count(p_rb);
+    if (offset >= count)
+    {
+        return 0;
+    }
+    count -= offset;
+
+    uint32_t start = p_rb->ridx + offset;
+    if (start >= p_rb->capacity)
+    {
+        start -= p_rb->capacity;
+    }
+
+    uint32_t first = p_rb->capacity - start;
+    if (first > count)
+    {
+        first = count;
+    }
+
+    p_segs[0].p_data = &p_rb->p_buf[start];
+    p_segs[0].count = first;
+
+    if (first == count)
+    {
+        return 1;
+    }
+
+    p_segs[1].p_data = p_rb->p_buf;
+    p_segs[1].count = count - first;
+
+    return 2;
+} /* End of rbuffer_peek_segments() */
+
+/*!
+ * @brief Removes the oldest data from the ring buffer without copying it.
+ * @param[in,out] p_rb Pointer to the ring buffer control structure.
+ * @param[in] count Number of elements to remove.
+ * @return Number of elements removed, which is less than count if fewer data
+ * are stored. Returns 0 if p_rb is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t rbuffer_discard(rbuffer_t *p_rb, uint32_t count)
+{
+    if (NULL == p_rb)
+    {
+        return 0;
+    }
+
+    uint32_t avail = rbuffer_data_count(p_rb);
+    if (count > avail)
+    {
+        count = avail;
+    }
+
+    if (0 == count)
+    {
+        return 0;
+    }
+
+    uint32_t ridx = p_rb->ridx + count;
+    if (ridx >= p_rb->capacity)
+    {
+        ridx -= p_rb->capacity;
+    }
+
+    uint32_t seq = rbuffer_seq_begin(p_rb);
+    p_rb->rpart = 0;
+    rbuffer_store_ridx(p_rb, ridx);
+    rbuffer_store_full(p_rb, false);
+    rbuffer_seq_end(p_rb, seq);
+
+    return count;
+} /* End of rbuffer_discard() */
+
+/*!
+ * @brief Reads a stored element by position without removing it.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] index Position of the element; 0 is the oldest. The element k
+ * positions back from the newest is at rbuffer_data_count() - 1 - k.
+ * @param[out] p_data Pointer to variable that receives the data.
+ * @return true If the element was read.
+ * @return false If p_rb or p_data is NULL, or index is not less than the data
+ * count.
+ * @note Time complexity: O(1)
+ */
+bool rbuffer_at(const rbuffer_t *p_rb, uint32_t index, int32_t *p_data)
+{
+    if (NULL == p_rb || NULL == p_data)
+    {
+        return false;
+    }
+
+    if (index >= rbuffer_data_count(p_rb))
+    {
+        return false;
+    }
+
+    uint32_t idx = p_rb->ridx + index;
+    if (idx >= p_rb->capacity)
+    {
+        idx -= p_rb->capacity;
+    }
+
+    *p_data = p_rb->p_buf[idx];
+
+    return true;
+} /* End of rbuffer_at() */
+
+/*!
+ * @brief Copies a range of stored elements without removing them.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] offset Position of the first element to copy; 0 is the oldest.
+ * @param[out] p_out Pointer to the array that receives the elements, oldest
+ * first.
+ * @param[in] count Maximum number of elements to copy.
+ * @return Number of elements copied, which is less than count if fewer data
+ * are stored past offset. Returns 0 if p_rb or p_out is NULL.
+ * @note Time complexity: O(count), with at most two memcpy() calls.
+ */
+uint32_t rbuffer_copy_range(const rbuffer_t *p_rb, uint32_t offset,
+                            int32_t *p_out, uint32_t count)
+{
+    if (NULL == p_rb || NULL == p_out)
+    {
+        return 0;
+    }
+
+    rbuffer_segment_t segs[2];
+    uint32_t seg_count = rbuffer_peek_segments(p_rb, offset, segs);
+    uint32_t copied = 0;
+
+    for (uint32_t i = 0; (i < seg_count) && (copied < count); i++)
+    {
+        uint32_t n = segs[i].count;
+        if (n > (count - copied))
+        {
+            n = count - copied;
+        }
+
+        memcpy(&p_out[copied], segs[i].p_data, n * sizeof(int32_t));
+        copied += n;
+    }
+
+    return copied;
+} /* End of rbuffer_copy_range() */
+
+/*!
+ * @brief Copies the most recently written elements without removing them.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[out] p_out Pointer to the array that receives the elements, oldest
+ * first.
+ * @param[in] count Maximum number of elements to copy.
+ * @return Number of elements copied, which is less than count if fewer data
+ * are stored. Returns 0 if p_rb or p_out is NULL.
+ * @note Time complexity: O(count), with at most two memcpy() calls.
+ */
+uint32_t rbuffer_peek_latest(const rbuffer_t *p_rb, int32_t *p_out,
+                             uint32_t count)
+{
+    if (NULL == p_rb || NULL == p_out)
+    {
+        return 0;
+    }
+
+    uint32_t avail = rbuffer_data_count(p_rb);
+    if (count > avail)
+    {
+        count = avail;
+    }
+
+    return rbuffer_copy_range(p_rb, avail - count, p_out, count);
+} /* End of rbuffer_peek_latest() */
+
+#ifdef RBUFFER_SNAPSHOT
+
+/*!
+ * @brief Copies all stored data consistently while another thread may keep
+ * modifying the buffer.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[out] p_out Pointer to an array of at least capacity elements that
+ * receives the data, oldest first.
+ * @param[out] p_count Pointer to variable that receives the number of elements
+ * copied.
+ * @param[in] max_retries Number of further attempts after the first one fails.
+ * @return true If a consistent copy was made.
+ * @return false If p_rb, p_out or p_count is NULL, or every attempt overlapped
+ * a modification. p_out may then hold partial data.
+ * @note Time complexity: O(n * (r + 1)), where n is the capacity and r the
+ * number of retries used.
+ * @note Every function that modifies the buffer makes the sequence counter odd
+ * while it updates the indices, and even again when done (a seqlock). A
+ * snapshot copies the window with at most two memcpy() calls and keeps it only
+ * if the counter was even and unchanged around the copy, so the writer is
+ * never blocked or slowed by readers. A single thread may modify the buffer;
+ * any number of threads may take snapshots. As in any seqlock, the copy may
+ * read slots being written, but such a copy is always discarded.
+ * @note Only available when RBUFFER_SNAPSHOT is defined for rbuffer.c and for
+ * every translation unit that uses the *_fast() functions; a mismatch fails to
+ * link. Without it the counter is not maintained and modifications pay nothing
+ * for it.
+ */
+bool rbuffer_snapshot(const rbuffer_t *p_rb, int32_t *p_out,
+                      uint32_t *p_count, uint32_t max_retries)
+{
+    if (NULL == p_rb || NULL == p_out || NULL == p_count)
+    {
+        return false;
+    }
+
+    uint32_t capacity = p_rb->capacity;
+
+    for (uint32_t retries = 0; ; retries++)
+    {
+        uint32_t seq = __atomic_load_n(&p_rb->seq, __ATOMIC_ACQUIRE);
+        uint32_t ridx = __atomic_load_n(&p_rb->ridx, __ATOMIC_RELAXED);
+        uint32_t widx = __atomic_load_n(&p_rb->widx, __ATOMIC_RELAXED);
+        bool b_is_full = __atomic_load_n(&p_rb->b_is_full, __ATOMIC_RELAXED);
+
+        /* An odd counter means an update is in progress; indices read during
+         * one may be out of range and must not be used. */
+        if ((0 == (seq & 1U)) && (ridx < capacity) && (widx < capacity))
+        {
+            uint32_t count;
+            if (b_is_full)
+            {
+                count = capacity;
+            }
+            else if (widx >= ridx)
+            {
+                count = widx - ridx;
+            }
+            else
+            {
+                count = capacity - ridx + widx;
+            }
+
+            uint32_t first = capacity - ridx;
+            if (first > count)
+            {
+                first = count;
+            }
+
+            memcpy(p_out, &p_rb->p_buf[ridx], first * sizeof(int32_t));
+            memcpy(&p_out[first], p_rb->p_buf,
+                   (count - first) * sizeof(int32_t));
+
+            /* Order the copy before re-reading the counter. */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (seq == __atomic_load_n(&p_rb->seq, __ATOMIC_RELAXED))
+            {
+                *p_count = count;
+                return true;
+            }
+        }
+
+        if (retries == max_retries)
+        {
+            return false;
+        }
+    }
+} /* End of rbuffer_snapshot() */
+
+#endif /* RBUFFER_SNAPSHOT */
+
+/*!
+ * @brief Writes the complete state of the ring buffer to a file descriptor.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] fd File descriptor to write to, at its current position.
+ * @return true If the checkpoint was written.
+ * @return false If p_rb is NULL or a write fails.
+ * @note Time complexity: O(n), where n is the number of data in the buffer.
+ * @note The header, the (up to two) filled segments and the bytes of a
+ * partially filled element are written with a single writev(); only a short
+ * write causes further calls. Free slots are not written.
+ */
+bool rbuffer_checkpoint(const rbuffer_t *p_rb, int fd)
+{
+    if (NULL == p_rb)
+    {
+        return false;
+    }
+
+    rbuffer_file_header_t header = { 0 };
+    header.magic = RBUFFER_FILE_MAGIC;
+    header.version = RBUFFER_FILE_VERSION;
+    header.elem_size = sizeof(int32_t);
+    header.capacity = p_rb->capacity;
+    header.ridx = p_rb->ridx;
+    header.widx = p_rb->widx;
+    header.b_is_full = p_rb->b_is_full ? 1 : 0;
+    header.rpart = p_rb->rpart;
+    header.wpart = p_rb->wpart;
+
+    rbuffer_segment_t segs[2];
+    uint32_t seg_count = rbuffer_peek_segments(p_rb, 0, segs);
+    struct iovec iov[4];
+    int iov_count = 1;
+
+    iov[0].iov_base = &header;
+    iov[0].iov_len = sizeof(header);
+    for (uint32_t i = 0; i < seg_count; i++)
+    {
+        iov[iov_count].iov_base = (void *)segs[i].p_data;
+        iov[iov_count].iov_len = segs[i].count * sizeof(int32_t);
+        iov_count++;
+    }
+
+    if (p_rb->wpart > 0)
+    {
+        /* Bytes of an element whose fill from an fd stopped midway. */
+        iov[iov_count].iov_base = &p_rb->p_buf[p_rb->widx];
+        iov[iov_count].iov_len = p_rb->wpart;
+        iov_count++;
+    }
+
+    return rbuffer_transfer_all(fd, iov, iov_count, true);
+} /* End of rbuffer_checkpoint() */
+
+/*!
+ * @brief Creates a ring buffer from a checkpoint written by
+ * rbuffer_checkpoint().
+ * @param[in] fd File descriptor to read from, at its current position.
+ * @return Pointer to the restored ring buffer, or NULL if the checkpoint is
+ * invalid or truncated, or if a read or memory allocation fails.
+ * @note Time complexity: O(n), where n is the number of data in the buffer.
+ * @note Two reads are made: the header, then the data, which is read
+ * straight into its original slots with a single readv(). The data cannot be
+ * placed before the header has been validated. Read order, indices, the full
+ * (overwrite) state and the offsets of a transfer to or from an fd that
+ * stopped mid-element are exactly those of the checkpointed buffer.
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling rbuffer_destroy().
+ */
+rbuffer_t* rbuffer_restore(int fd)
+{
+    rbuffer_file_header_t header;
+    struct iovec iov[3];
+
+    iov[0].iov_base = &header;
+    iov[0].iov_len = sizeof(header);
+    if (!rbuffer_transfer_all(fd, iov, 1, false))
+    {
+        return NULL;
+    }
+
+    if ((RBUFFER_FILE_MAGIC != header.magic) ||
+        (RBUFFER_FILE_VERSION != header.version) ||
+        (sizeof(int32_t) != header.elem_size) ||
+        (header.ridx >= header.capacity) || (header.widx >= header.capacity) ||
+        ((0 != header.b_is_full) && (header.ridx != header.widx)) ||
+        (header.rpart >= sizeof(int32_t)) || (header.wpart >= sizeof(int32_t)))
+    {
+        /* Not a valid checkpoint. */
+        return NULL;
+    }
+
+    /* A partial element can only be drained from data, and only be filled
+     * into a free slot. */
+    bool b_empty = (header.ridx == header.widx) && (0 == header.b_is_full);
+    if ((b_empty && (0 != header.rpart)) ||
+        ((0 != header.b_is_full) && (0 != header.wpart)))
+    {
+        /* Not a valid checkpoint. */
+        return NULL;
+    }
+
+    rbuffer_t *p_rb = rbuffer_create(header.capacity);
+    if (NULL == p_rb)
+    {
+        return NULL;
+    }
+
+    p_rb->ridx = header.ridx;
+    p_rb->widx = header.widx;
+    p_rb->b_is_full = (0 != header.b_is_full);
+
+    /* rpart is still 0 here, so the first segment covers whole elements. */
+    int iov_count = rbuffer_data_segments(p_rb, iov);
+    if (header.wpart > 0)
+    {
+        iov[iov_count].iov_base = &p_rb->p_buf[p_rb->widx];
+        iov[iov_count].iov_len = header.wpart;
+        iov_count++;
+    }
+
+    if ((iov_count > 0) && !rbuffer_transfer_all(fd, iov, iov_count, false))
+    {
+        rbuffer_destroy(p_rb);
+        return NULL;
+    }
+
+    p_rb->rpart = header.rpart;
+    p_rb->wpart = header.wpart;
+
+    return p_rb;
+} /* End of rbuffer_restore() */
+
+/*!
+ * @brief Formats all data in the ring buffer into a caller-provided buffer.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] format Output format.
+ * @param[out] p_buf Buffer receiving the output. May be NULL if buf_size is 0.
+ * @param[in] buf_size Capacity of p_buf in bytes.
+ * @param[out] p_total Optional; receives the number of bytes the complete dump
+ * requires. May be NULL.
+ * @return Number of bytes stored in p_buf, which ends after the last whole
+ * element that fits. Returns 0 if p_rb is NULL.
+ * @note Time complexity: O(n), where n is the number of data in the buffer.
+ * @note Non-destructive, like rbuffer_display(). No NUL is appended.
+ */
+size_t rbuffer_dump(const rbuffer_t *p_rb, rbuffer_dump_format_t format,
+                    char *p_buf, size_t buf_size, size_t *p_total)
+{
+    if (NULL == p_rb)
+    {
+        return 0;
+    }
+
+    rbuffer_dump_ctx_t ctx = { 0 };
+    ctx.p_buf = p_buf;
+    ctx.size = (NULL != p_buf) ? buf_size : 0;
+    ctx.fd = -1;
+
+    rbuffer_dump_all(p_rb, format, &ctx);
+
+    if (NULL != p_total)
+    {
+        *p_total = ctx.total;
+    }
+
+    return ctx.len;
+} /* End of rbuffer_dump() */
+
+/*!
+ * @brief Formats all data in the ring buffer to a file descriptor.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] format Output format.
+ * @param[in] fd File descriptor to write to.
+ * @return true If the whole dump was written.
+ * @return false If p_rb is NULL, or if memory allocation or a write fails.
+ * @note Time complexity: O(n), where n is the number of data in the buffer.
+ * @note Text and CSV are formatted into a 64 KiB chunk written with one
+ * write() call at a time, bypassing stdio and its per-call locking. Binary
+ * output is written straight from the buffer with a single writev().
+ */
+bool rbuffer_dump_fd(const rbuffer_t *p_rb, rbuffer_dump_format_t format,
+                     int fd)
+{
+    if (NULL == p_rb)
+    {
+        return false;
+    }
+
+    if (RBUFFER_DUMP_BINARY == format)
+    {
+        rbuffer_segment_t segs[2];
+        struct iovec iov[2];
+        uint32_t seg_count = rbuffer_peek_segments(p_rb, 0, segs);
+
+        for (uint32_t i = 0; i < seg_count; i++)
+        {
+            iov[i].iov_base = (void *)segs[i].p_data;
+            iov[i].iov_len = segs[i].count * sizeof(int32_t);
+        }
+
+        return rbuffer_transfer_all(fd, iov, (int)seg_count, true);
+    }
+
+    rbuffer_dump_ctx_t ctx = { 0 };
+    ctx.p_buf = malloc(RBUFFER_DUMP_CHUNK);
+    ctx.size = RBUFFER_DUMP_CHUNK;
+    ctx.fd = fd;
+    if (NULL == ctx.p_buf)
+    {
+        /* Memory allocation failed. */
+        return false;
+    }
+
+    rbuffer_dump_all(p_rb, format, &ctx);
+    rbuffer_dump_flush(&ctx);
+    free(ctx.p_buf);
+
+    return !ctx.b_error;
+} /* End of rbuffer_dump_fd() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Describes the filled part of the ring buffer as I/O vectors.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[out] p_iov Array of two vectors receiving the segments, oldest first.
+ * @return Number of segments used (0, 1 or 2).
+ * @note The first segment skips the bytes already drained (rpart).
+ */
+static int rbuffer_data_segments(const rbuffer_t *p_rb, struct iovec *p_iov)
+{
+    uint32_t count = rbuffer_data_count(p_rb);
+    if (0 == count)
+    {
+        return 0;
+    }
+
+    uint32_t first = p_rb->capacity - p_rb->ridx;
+    if (first > count)
+    {
+        first = count;
+    }
+
+    p_iov[0].iov_base = (uint8_t *)&p_rb->p_buf[p_rb->ridx] + p_rb->rpart;
+    p_iov[0].iov_len = (first * sizeof(int32_t)) - p_rb->rpart;
+
+    if (first == count)
+    {
+        return 1;
+    }
+
+    p_iov[1].iov_base = p_rb->p_buf;
+    p_iov[1].iov_len = (count - first) * sizeof(int32_t);
+
+    return 2;
+} /* End of rbuffer_data_segments() */
+
+/*!
+ * @brief Describes the free part of the ring buffer as I/O vectors.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[out] p_iov Array of two vectors receiving the segments, in write
+ * order.
+ * @return Number of segments used (0, 1 or 2).
+ * @note The first segment skips the bytes already filled (wpart).
+ */
+static int rbuffer_free_segments(const rbuffer_t *p_rb, struct iovec *p_iov)
+{
+    uint32_t count = rbuffer_free_count(p_rb);
+    if (0 == count)
+    {
+        return 0;
+    }
+
+    uint32_t first = p_rb->capacity - p_rb->widx;
+    if (first > count)
+    {
+        first = count;
+    }
+
+    p_iov[0].iov_base = (uint8_t *)&p_rb->p_buf[p_rb->widx] + p_rb->wpart;
+    p_iov[0].iov_len = (first * sizeof(int32_t)) - p_rb->wpart;
+
+    if (first == count)
+    {
+        return 1;
+    }
+
+    p_iov[1].iov_base = p_rb->p_buf;
+    p_iov[1].iov_len = (count - first) * sizeof(int32_t);
+
+    return 2;
+} /* End of rbuffer_free_segments() */
+
+
+/*!
+ * @brief Transfers every byte described by an I/O vector array.
+ * @param[in] fd File descriptor to transfer to or from.
+ * @param[in,out] p_iov I/O vectors; consumed as the transfer progresses.
+ * @param[in] iov_count Number of vectors.
+ * @param[in] b_write true to writev(), false to readv().
+ * @return true If all bytes were transferred.
+ * @return false On error or end of file.
+ * @note Normally a single system call; short transfers and EINTR are retried
+ * from the first byte not transferred.
+ */
+static bool rbuffer_transfer_all(int fd, struct iovec *p_iov, int iov_count,
+                                 bool b_write)
+{
+    while (iov_count > 0)
+    {
+        ssize_t n = b_write ? writev(fd, p_iov, iov_count) :
+                              readv(fd, p_iov, iov_count);
+        if (n < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        if (0 == n)
+        {
+            /* Unexpected end of file. */
+            return false;
+        }
+
+        /* Skip the vectors that are complete and trim the partial one. */
+        while ((iov_count > 0) && ((size_t)n >= p_iov->iov_len))
+        {
+            n -= (ssize_t)p_iov->iov_len;
+            p_iov++;
+            iov_count--;
+        }
+
+        if (iov_count > 0)
+        {
+            p_iov->iov_base = (uint8_t *)p_iov->iov_base + n;
+            p_iov->iov_len -= (size_t)n;
+        }
+    }
+
+    return true;
+} /* End of rbuffer_transfer_all() */
+
+/*!
+ * @brief Emits the stored data, oldest first, in the requested format.
+ * @param[in] p_rb Pointer to the ring buffer control structure.
+ * @param[in] format Output format.
+ * @param[in,out] p_ctx Output state.
+ */
+static void rbuffer_dump_all(const rbuffer_t *p_rb,
+                             rbuffer_dump_format_t format,
+                             rbuffer_dump_ctx_t *p_ctx)
+{
+    rbuffer_segment_t segs[2];
+    uint32_t seg_count = rbuffer_peek_segments(p_rb, 0, segs);
+    char token[RBUFFER_INT_CHARS + 2];
+    bool b_first = true;
+
+    for (uint32_t s = 0; s < seg_count; s++)
+    {
+        for (uint32_t i = 0; i < segs[s].count; i++)
+        {
+            if (RBUFFER_DUMP_BINARY == format)
+            {
+                rbuffer_dump_emit(p_ctx, &segs[s].p_data[i], sizeof(int32_t));
+                continue;
+            }
+
+            size_t len = 0;
+            if ((RBUFFER_DUMP_CSV == format) && !b_first)
+            {
+                token[len++] = ',';
+            }
+            len += rbuffer_format_int(segs[s].p_data[i], &token[len]);
+            if (RBUFFER_DUMP_TEXT == format)
+            {
+                token[len++] = ' ';
+            }
+            rbuffer_dump_emit(p_ctx, token, len);
+            b_first = false;
+        }
+    }
+
+    if (RBUFFER_DUMP_BINARY != format)
+    {
+        rbuffer_dump_emit(p_ctx, "\n", 1);
+    }
+} /* End of rbuffer_dump_all() */
+
+/*!
+ * @brief Appends a token to the dump output.
+ * @param[in,out] p_ctx Output state.
+ * @param[in] p_src Bytes to append.
+ * @param[in] len Number of bytes, at most RBUFFER_INT_CHARS + 2, so that in fd
+ * mode the token always fits once the chunk has been flushed.
+ */
+static void rbuffer_dump_emit(rbuffer_dump_ctx_t *p_ctx, const void *p_src,
+                              size_t len)
+{
+    bool b_stored_all = (p_ctx->len == p_ctx->total);
+
+    p_ctx->total += len;
+
+    if (p_ctx->fd < 0)
+    {
+        /* Once a token has been dropped, drop the rest too. */
+        if (b_stored_all && (len <= (p_ctx->size - p_ctx->len)))
+        {
+            memcpy(&p_ctx->p_buf[p_ctx->len], p_src, len);
+            p_ctx->len += len;
+        }
+        return;
+    }
+
+    if (len > (p_ctx->size - p_ctx->len))
+    {
+        rbuffer_dump_flush(p_ctx);
+    }
+
+    memcpy(&p_ctx->p_buf[p_ctx->len], p_src, len);
+    p_ctx->len += len;
+} /* End of rbuffer_dump_emit() */
+
+/*!
+ * @brief Writes out the staged chunk and empties it.
+ * @param[in,out] p_ctx Output state with a valid fd.
+ * @note Short writes and EINTR are retried; any other failure sets b_error,
+ * after which nothing more is written.
+ */
+static void rbuffer_dump_flush(rbuffer_dump_ctx_t *p_ctx)
+{
+    if (!p_ctx->b_error && (p_ctx->len > 0))
+    {
+        struct iovec iov = { p_ctx->p_buf, p_ctx->len };
+        p_ctx->b_error = !rbuffer_transfer_all(p_ctx->fd, &iov, 1, true);
+    }
+
+    p_ctx->len = 0;
+} /* End of rbuffer_dump_flush() */
+
+/*!
+ * @brief Writes the decimal representation of an int32_t.
+ * @param[in] value Value to convert.
+ * @param[out] p_out At least RBUFFER_INT_CHARS bytes; not NUL-terminated.
+ * @return Number of characters written.
+ * @note Digits are generated right to left, two per division, using the
+ * g_digit_pairs lookup table.
+ */
+static size_t rbuffer_format_int(int32_t value, char *p_out)
+{
+    char tmp[RBUFFER_INT_CHARS];
+    char *p_pos = &tmp[RBUFFER_INT_CHARS];
+    uint32_t u = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+
+    while (u >= 100U)
+    {
+        uint32_t idx = (u % 100U) * 2U;
+        u /= 100U;
+        *--p_pos = g_digit_pairs[idx + 1U];
+        *--p_pos = g_digit_pairs[idx];
+    }
+
+    if (u >= 10U)
+    {
+        *--p_pos = g_digit_pairs[(u * 2U) + 1U];
+        *--p_pos = g_digit_pairs[u * 2U];
+    }
+    else
+    {
+        *--p_pos = (char)('0' + u);
+    }
+
+    if (value < 0)
+    {
+        *--p_pos = '-';
+    }
+
+    size_t len = (size_t)(&tmp[RBUFFER_INT_CHARS] - p_pos);
+    memcpy(p_out, p_pos, len);
+
+    return len;
+} /* End of rbuffer_format_int() */
 
 /*** End of file: rbuffer.c */
\ No newline at end of file
@@ -16,14 +16,59 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+/* Bytes reserved by rbuffer_storage_t; checked against rbuffer_t at build. */
+#define RBUFFER_STORAGE_SIZE    (48U)
 
 /* Opaque type declarations --------------------------------------------------*/
 
 typedef struct rbuffer_t rbuffer_t;
 
+/* Public data types ---------------------------------------------------------*/
+
+/*!
+ * @brief Caller-provided memory for a ring buffer control structure.
+ * @note Only its size and alignment are public; pass it to rbuffer_init() and
+ * use the returned rbuffer_t pointer.
+ */
+typedef union
+{
+    void *p_align;
+    uint64_t align;
+    unsigned char bytes[RBUFFER_STORAGE_SIZE];
+} rbuffer_storage_t;
+
+/*!
+ * @brief Contiguous run of data stored in a ring buffer.
+ */
+typedef struct
+{
+    const int32_t *p_data;
+    uint32_t count;
+} rbuffer_segment_t;
+
+/*!
+ * @brief Output formats of rbuffer_dump() and rbuffer_dump_fd().
+ */
+typedef enum
+{
+    RBUFFER_DUMP_TEXT,      /* Same as rbuffer_display(): "1 2 \n". */
+    RBUFFER_DUMP_CSV,       /* One line of comma-separated values: "1,2\n". */
+    RBUFFER_DUMP_BINARY     /* Raw int32_t values in host byte order. */
+} rbuffer_dump_format_t;
+
 /* Public APIs ---------------------------------------------------------------*/
 
 rbuffer_t* rbuffer_create(uint32_t capacity);
+rbuffer_t* rbuffer_init(rbuffer_storage_t *p_storage, int32_t *p_buf,
+                        uint32_t capacity);
 bool rbuffer_read(rbuffer_t *p_rb, int32_t *p_data);
 bool rbuffer_write(rbuffer_t *p_rb, int32_t data);
 uint32_t rbuffer_data_count(const rbuffer_t *p_rb);
@@ -33,6 +78,34 @@ bool rbuffer_is_full(const rbuffer_t *p_rb);
 bool rbuffer_clear(rbuffer_t *p_rb);
 void rbuffer_destroy(rbuffer_t *p_rb);
 void rbuffer_display(const rbuffer_t *p_rb);
+ssize_t rbuffer_fill_from_fd(rbuffer_t *p_rb, int fd);
+ssize_t rbuffer_drain_to_fd(rbuffer_t *p_rb, int fd);
+uint32_t rbuffer_peek_segments(const rbuffer_t *p_rb, uint32_t offset,
+                               rbuffer_segment_t *p_segs);
+uint32_t rbuffer_discard(rbuffer_t *p_rb, uint32_t count);
+bool rbuffer_at(const rbuffer_t *p_rb, uint32_t index, int32_t *p_data);
+uint32_t rbuffer_copy_range(const rbuffer_t *p_rb, uint32_t offset,
+                            int32_t *p_out, uint32_t count);
+uint32_t rbuffer_peek_latest(const rbuffer_t *p_rb, int32_t *p_out,
+                             uint32_t count);
+#ifdef RBUFFER_SNAPSHOT     /* Opt-in seqlock; see rbuffer_snapshot(). */
+bool rbuffer_snapshot(const rbuffer_t *p_rb, int32_t *p_out,
+                      uint32_t *p_count, uint32_t max_retries);
+#endif
+bool rbuffer_checkpoint(const rbuffer_t *p_rb, int fd);
+rbuffer_t* rbuffer_restore(int fd);
+size_t rbuffer_dump(const rbuffer_t *p_rb, rbuffer_dump_format_t format,
+                    char *p_buf, size_t buf_size, size_t *p_total);
+bool rbuffer_dump_fd(const rbuffer_t *p_rb, rbuffer_dump_format_t format,
+                     int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef RBUFFER_INLINE
+#include "rbuffer_inline.h"   /* Opt-in unchecked fast paths. */
+#endif
 
 #endif /* RBUFFER_H */
 
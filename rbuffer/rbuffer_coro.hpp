@@ -0,0 +1,349 @@
+/*******************************************************************************
+ *
+ * @file    rbuffer_coro.hpp
+ * @brief   C++20 coroutine awaitables for the ring buffer.
+ * @details This header wraps an rbuffer_t so that coroutines can write
+ *          `int32_t v = co_await ring.read();` and `co_await ring.write(v);`
+ *          instead of polling rbuffer_read() in a loop. A read suspends while
+ *          the ring is empty and a write suspends while the ring is full; each
+ *          is resumed by the opposite operation through a single-threaded
+ *          executor.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Unlike rbuffer_write(), an awaited write never overwrites the
+ *          oldest data. All coroutines sharing a ring must run on the same
+ *          executor thread.
+ *
+ ******************************************************************************/
+
+#ifndef RBUFFER_CORO_HPP
+#define RBUFFER_CORO_HPP
+
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <new>
+#include <utility>
+#include "rbuffer.h"
+
+namespace dsa
+{
+
+/* Task ----------------------------------------------------------------------*/
+
+/*!
+ * @brief Fire-and-forget coroutine handle that is started by an executor.
+ * @note The coroutine frame is created suspended and destroys itself when the
+ * coroutine body returns. A task that is never spawned is destroyed together
+ * with the task object.
+ */
+class coro_task
+{
+public:
+    struct promise_type
+    {
+        coro_task get_return_object() noexcept
+        {
+            return coro_task(
+                std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    coro_task(coro_task &&other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    coro_task(const coro_task &) = delete;
+    coro_task& operator=(const coro_task &) = delete;
+    coro_task& operator=(coro_task &&) = delete;
+
+    ~coro_task()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    /*!
+     * @brief Releases ownership of the suspended coroutine frame.
+     * @return Handle of the coroutine; the caller is responsible for resuming
+     * it exactly once.
+     */
+    std::coroutine_handle<> release() noexcept
+    {
+        return std::exchange(m_handle, nullptr);
+    }
+
+private:
+    explicit coro_task(std::coroutine_handle<promise_type> handle) noexcept
+        : m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/* Executor ------------------------------------------------------------------*/
+
+/*!
+ * @brief Single-threaded executor running ready coroutines in FIFO order.
+ */
+class coro_executor
+{
+public:
+    /*!
+     * @brief Schedules a task to be started by the next call to run().
+     * @param[in] task Task to take ownership of.
+     */
+    void spawn(coro_task task)
+    {
+        m_ready.push_back(task.release());
+    }
+
+    /*!
+     * @brief Schedules a suspended coroutine to be resumed by run().
+     * @param[in] handle Handle of the coroutine to resume.
+     */
+    void schedule(std::coroutine_handle<> handle)
+    {
+        m_ready.push_back(handle);
+    }
+
+    /*!
+     * @brief Resumes ready coroutines until none is left.
+     * @return Number of coroutine resumptions performed.
+     * @note Coroutines still waiting on a ring when this function returns stay
+     * suspended; they are resumed by a later run() once they become ready.
+     */
+    std::uint64_t run()
+    {
+        std::uint64_t resumed = 0;
+
+        while (!m_ready.empty())
+        {
+            std::coroutine_handle<> handle = m_ready.front();
+            m_ready.pop_front();
+            handle.resume();
+            resumed++;
+        }
+
+        return resumed;
+    }
+
+private:
+    std::deque<std::coroutine_handle<>> m_ready;
+};
+
+/* Ring ----------------------------------------------------------------------*/
+
+/*!
+ * @brief Ring buffer of int32_t whose reads and writes can be awaited.
+ * @note Waiting coroutines are kept in intrusive FIFO lists threaded through
+ * the awaiter objects, which live in the suspended coroutine frames, so
+ * suspending never allocates.
+ */
+class coro_ring
+{
+private:
+    struct waiter
+    {
+        std::coroutine_handle<> handle;
+        std::int32_t data;
+        waiter *p_next;
+    };
+
+    struct wait_list
+    {
+        waiter *p_head = nullptr;
+        waiter *p_tail = nullptr; /* Enables O(1) enqueue. */
+
+        void push(waiter *p_new) noexcept
+        {
+            p_new->p_next = nullptr;
+            if (nullptr == p_head)
+            {
+                p_head = p_new;
+            }
+            else
+            {
+                p_tail->p_next = p_new;
+            }
+            p_tail = p_new;
+        }
+
+        waiter* pop() noexcept
+        {
+            waiter *p_remove = p_head;
+            if (nullptr != p_remove)
+            {
+                p_head = p_remove->p_next;
+                if (nullptr == p_head)
+                {
+                    p_tail = nullptr;
+                }
+            }
+            return p_remove;
+        }
+    };
+
+public:
+    /*!
+     * @brief Awaiter returned by read().
+     * @note If the ring is empty, the coroutine is suspended until a writer
+     * hands a value over directly, so a woken reader never finds the ring
+     * emptied again by another reader.
+     */
+    class read_awaiter
+    {
+    public:
+        explicit read_awaiter(coro_ring &ring) noexcept : m_ring(ring) {}
+
+        bool await_ready() noexcept
+        {
+            if (!rbuffer_read(m_ring.m_p_rb, &m_waiter.data))
+            {
+                return false;
+            }
+
+            /* A slot was freed: let the oldest blocked writer fill it. */
+            waiter *p_writer = m_ring.m_writers.pop();
+            if (nullptr != p_writer)
+            {
+                rbuffer_write(m_ring.m_p_rb, p_writer->data);
+                m_ring.m_executor.schedule(p_writer->handle);
+            }
+
+            return true;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            m_waiter.handle = handle;
+            m_ring.m_readers.push(&m_waiter);
+        }
+
+        std::int32_t await_resume() const noexcept
+        {
+            return m_waiter.data;
+        }
+
+    private:
+        coro_ring &m_ring;
+        waiter m_waiter{};
+    };
+
+    /*!
+     * @brief Awaiter returned by write().
+     * @note If a reader is already waiting, the value is handed to it without
+     * touching the ring. If the ring is full, the coroutine is suspended until
+     * a reader frees a slot and stores the value on its behalf.
+     */
+    class write_awaiter
+    {
+    public:
+        write_awaiter(coro_ring &ring, std::int32_t data) noexcept
+            : m_ring(ring)
+        {
+            m_waiter.data = data;
+        }
+
+        bool await_ready() noexcept
+        {
+            waiter *p_reader = m_ring.m_readers.pop();
+            if (nullptr != p_reader)
+            {
+                /* Readers only wait on an empty ring: hand over directly. */
+                p_reader->data = m_waiter.data;
+                m_ring.m_executor.schedule(p_reader->handle);
+                return true;
+            }
+
+            if (rbuffer_is_full(m_ring.m_p_rb))
+            {
+                return false;
+            }
+
+            rbuffer_write(m_ring.m_p_rb, m_waiter.data);
+            return true;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            m_waiter.handle = handle;
+            m_ring.m_writers.push(&m_waiter);
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        coro_ring &m_ring;
+        waiter m_waiter{};
+    };
+
+    /*!
+     * @brief Creates an awaitable ring buffer.
+     * @param[in] executor Executor that resumes coroutines blocked on the ring.
+     * @param[in] capacity Maximum number of elements the ring can store.
+     * @throw std::bad_alloc If rbuffer_create() fails.
+     */
+    coro_ring(coro_executor &executor, std::uint32_t capacity)
+        : m_executor(executor), m_p_rb(rbuffer_create(capacity))
+    {
+        if (nullptr == m_p_rb)
+        {
+            throw std::bad_alloc();
+        }
+    }
+
+    coro_ring(const coro_ring &) = delete;
+    coro_ring& operator=(const coro_ring &) = delete;
+
+    ~coro_ring()
+    {
+        rbuffer_destroy(m_p_rb);
+    }
+
+    /*!
+     * @brief Returns an awaitable that yields the oldest element.
+     */
+    read_awaiter read() noexcept
+    {
+        return read_awaiter(*this);
+    }
+
+    /*!
+     * @brief Returns an awaitable that stores data once space is available.
+     * @param[in] data Data to write to the ring.
+     */
+    write_awaiter write(std::int32_t data) noexcept
+    {
+        return write_awaiter(*this, data);
+    }
+
+    /*!
+     * @brief Returns the underlying ring buffer for non-blocking inspection.
+     */
+    const rbuffer_t* native() const noexcept
+    {
+        return m_p_rb;
+    }
+
+private:
+    coro_executor &m_executor;
+    rbuffer_t *m_p_rb;
+    wait_list m_readers;
+    wait_list m_writers;
+};
+
+} /* namespace dsa */
+
+#endif /* RBUFFER_CORO_HPP */
+
+/*** End of file: rbuffer_coro.hpp ***/
@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *
+ * @file    rbuffer_inline.h
+ * @brief   Definition of rbuffer_t and inlinable fast-path operations.
+ * @details The checked APIs in rbuffer.h are compiled in rbuffer.c, so each
+ *          call in a tight loop pays for a call across translation units plus
+ *          NULL checks the compiler cannot hoist. Defining RBUFFER_INLINE
+ *          before including rbuffer.h (or passing -DRBUFFER_INLINE) also pulls
+ *          in this header, which exposes the structure definition and the
+ *          static inline *_fast() variants below.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The *_fast() functions perform no argument checks: the caller
+ *          guarantees valid, non-NULL pointers. They keep exactly the same
+ *          buffer semantics as their checked counterparts, and both kinds of
+ *          call may be mixed on the same buffer. Code that does not define
+ *          RBUFFER_INLINE still sees rbuffer_t as an opaque type.
+ *
+ ******************************************************************************/
+
+#ifndef RBUFFER_INLINE_H
+#define RBUFFER_INLINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rbuffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Structure representing a ring buffer.
+ * @note Members must only be accessed by rbuffer.c and the functions in this
+ * header.
+ */
+struct rbuffer_t
+{
+    int32_t *p_buf;
+    uint32_t capacity;
+    uint32_t ridx;   /* Read index. */
+    uint32_t widx;   /* Write index. */
+    uint32_t rpart;  /* Bytes of p_buf[ridx] already drained to an fd. */
+    uint32_t wpart;  /* Bytes of p_buf[widx] already filled from an fd. */
+    bool b_is_full;
+    bool b_is_static; /* Memory provided by the caller of rbuffer_init(). */
+    uint32_t seq;     /* Odd while the indices are updated; only kept with
+                       * RBUFFER_SNAPSHOT (see rbuffer_snapshot()). */
+};
+
+/* Snapshot sequence counter -------------------------------------------------*/
+
+/* The counter costs every modification a store and a fence, so it is only
+ * maintained when RBUFFER_SNAPSHOT is defined; otherwise these functions are
+ * empty and compile to nothing. The member is kept either way, so rbuffer_t
+ * has the same layout in every build.
+ *
+ * A *_fast() function built without the counter would let rbuffer_snapshot()
+ * accept torn copies, so every translation unit that includes this header must
+ * agree with rbuffer.c. rbuffer.c defines only the marker matching its own
+ * setting, and each includer keeps a reference to the marker matching its
+ * setting: a mismatch fails to link with an undefined reference to
+ * rbuffer_abi_snapshot or rbuffer_abi_plain. */
+#ifdef RBUFFER_SNAPSHOT
+
+extern const char rbuffer_abi_snapshot;
+static const char *const rbuffer_abi_check __attribute__((used)) =
+    &rbuffer_abi_snapshot;
+
+/*!
+ * @brief Marks the start of an update that rbuffer_snapshot() must not see
+ * halfway.
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @return The odd counter value, to be passed to rbuffer_seq_end().
+ * @note Time complexity: O(1). Only the thread that modifies the buffer calls
+ * this, so the counter itself needs no atomic read-modify-write.
+ */
+static inline uint32_t rbuffer_seq_begin(rbuffer_t *p_rb)
+{
+    uint32_t seq = p_rb->seq + 1U;
+
+    __atomic_store_n(&p_rb->seq, seq, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    return seq;
+} /* End of rbuffer_seq_begin() */
+
+/*!
+ * @brief Marks the end of an update started with rbuffer_seq_begin().
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @param[in] seq Value returned by rbuffer_seq_begin().
+ * @note Time complexity: O(1)
+ */
+static inline void rbuffer_seq_end(rbuffer_t *p_rb, uint32_t seq)
+{
+    __atomic_store_n(&p_rb->seq, seq + 1U, __ATOMIC_RELEASE);
+} /* End of rbuffer_seq_end() */
+
+#else
+
+extern const char rbuffer_abi_plain;
+static const char *const rbuffer_abi_check __attribute__((used)) =
+    &rbuffer_abi_plain;
+
+static inline uint32_t rbuffer_seq_begin(rbuffer_t *p_rb)
+{
+    (void)p_rb;
+    return 0;
+} /* End of rbuffer_seq_begin() */
+
+static inline void rbuffer_seq_end(rbuffer_t *p_rb, uint32_t seq)
+{
+    (void)p_rb;
+    (void)seq;
+} /* End of rbuffer_seq_end() */
+
+#endif /* RBUFFER_SNAPSHOT */
+
+/*!
+ * @brief Stores a new read index.
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @param[in] ridx New read index.
+ * @note Time complexity: O(1). rbuffer_snapshot() reads the indices and the
+ * full flag from other threads, so with RBUFFER_SNAPSHOT they are stored
+ * atomically; otherwise this is a plain store.
+ */
+static inline void rbuffer_store_ridx(rbuffer_t *p_rb, uint32_t ridx)
+{
+#ifdef RBUFFER_SNAPSHOT
+    __atomic_store_n(&p_rb->ridx, ridx, __ATOMIC_RELAXED);
+#else
+    p_rb->ridx = ridx;
+#endif
+} /* End of rbuffer_store_ridx() */
+
+/*!
+ * @brief Stores a new write index; see rbuffer_store_ridx().
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @param[in] widx New write index.
+ * @note Time complexity: O(1)
+ */
+static inline void rbuffer_store_widx(rbuffer_t *p_rb, uint32_t widx)
+{
+#ifdef RBUFFER_SNAPSHOT
+    __atomic_store_n(&p_rb->widx, widx, __ATOMIC_RELAXED);
+#else
+    p_rb->widx = widx;
+#endif
+} /* End of rbuffer_store_widx() */
+
+/*!
+ * @brief Stores a new full flag; see rbuffer_store_ridx().
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @param[in] b_is_full New full flag.
+ * @note Time complexity: O(1)
+ */
+static inline void rbuffer_store_full(rbuffer_t *p_rb, bool b_is_full)
+{
+#ifdef RBUFFER_SNAPSHOT
+    __atomic_store_n(&p_rb->b_is_full, b_is_full, __ATOMIC_RELAXED);
+#else
+    p_rb->b_is_full = b_is_full;
+#endif
+} /* End of rbuffer_store_full() */
+
+/* Inline fast-path APIs -----------------------------------------------------*/
+
+/*!
+ * @brief Unchecked rbuffer_read().
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @param[out] p_data Pointer to variable that receives the popped data. Must
+ * not be NULL.
+ * @return true If data was read.
+ * @return false If the buffer is empty.
+ * @note Time complexity: O(1)
+ */
+static inline bool rbuffer_read_fast(rbuffer_t *p_rb, int32_t *p_data)
+{
+    if ((p_rb->widx == p_rb->ridx) && !p_rb->b_is_full)
+    {
+        return false;
+    }
+
+    *p_data = p_rb->p_buf[p_rb->ridx];
+
+    uint32_t ridx = p_rb->ridx + 1U;
+    if (ridx >= p_rb->capacity)
+    {
+        ridx = 0;
+    }
+
+    uint32_t seq = rbuffer_seq_begin(p_rb);
+    p_rb->rpart = 0;
+    rbuffer_store_ridx(p_rb, ridx);
+    rbuffer_store_full(p_rb, false);
+    rbuffer_seq_end(p_rb, seq);
+
+    return true;
+} /* End of rbuffer_read_fast() */
+
+/*!
+ * @brief Unchecked rbuffer_write(); overwrites the oldest data when full.
+ * @param[in,out] p_rb Pointer to ring buffer control structure. Must not be
+ * NULL.
+ * @param[in] data Data to write to the buffer.
+ * @note Time complexity: O(1)
+ */
+static inline void rbuffer_write_fast(rbuffer_t *p_rb, int32_t data)
+{
+    uint32_t seq = rbuffer_seq_begin(p_rb);
+    uint32_t ridx = p_rb->ridx;
+    uint32_t widx = p_rb->widx;
+
+    if (p_rb->b_is_full)
+    {
+        p_rb->rpart = 0;
+        ridx++;
+        if (ridx >= p_rb->capacity)
+        {
+            ridx = 0;
+        }
+        rbuffer_store_ridx(p_rb, ridx);
+    }
+
+    p_rb->p_buf[widx] = data;
+    p_rb->wpart = 0;
+
+    widx++;
+    if (widx >= p_rb->capacity)
+    {
+        widx = 0;
+    }
+    rbuffer_store_widx(p_rb, widx);
+
+    rbuffer_store_full(p_rb, widx == ridx);
+
+    rbuffer_seq_end(p_rb, seq);
+} /* End of rbuffer_write_fast() */
+
+/*!
+ * @brief Unchecked rbuffer_is_empty().
+ * @param[in] p_rb Pointer to ring buffer control structure. Must not be NULL.
+ * @note Time complexity: O(1)
+ */
+static inline bool rbuffer_is_empty_fast(const rbuffer_t *p_rb)
+{
+    return (p_rb->widx == p_rb->ridx) && !p_rb->b_is_full;
+} /* End of rbuffer_is_empty_fast() */
+
+/*!
+ * @brief Unchecked rbuffer_is_full().
+ * @param[in] p_rb Pointer to ring buffer control structure. Must not be NULL.
+ * @note Time complexity: O(1)
+ */
+static inline bool rbuffer_is_full_fast(const rbuffer_t *p_rb)
+{
+    return p_rb->b_is_full;
+} /* End of rbuffer_is_full_fast() */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RBUFFER_INLINE_H */
+
+/*** End of file: rbuffer_inline.h ***/
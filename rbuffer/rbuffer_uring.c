@@ -0,0 +1,656 @@
+/*******************************************************************************
+ *
+ * @file    rbuffer_uring.c
+ * @brief   Implementation of an io_uring-based ring buffer drain.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definition of rbuffer_uring_t is intentionally kept private to
+ *          this source file to enforce encapsulation. The ring buffer itself
+ *          is only accessed through rbuffer_peek_segments() and
+ *          rbuffer_discard().
+ *
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include "rbuffer_uring.h"
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+/* Largest single write. Long segments are split so that a big ring is drained
+ * by several requests submitted as one batch. */
+#define URING_CHUNK_BYTES   (256U * 1024U)
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief One asynchronous write covering a contiguous run of the ring buffer.
+ */
+typedef struct
+{
+    const uint8_t *p_base;
+    off_t offset;       /* File offset of p_base. */
+    uint32_t bytes;     /* Total bytes to write. */
+    uint32_t done;      /* Bytes reported as written so far. */
+    uint32_t count;     /* Ring buffer elements covered. */
+    bool b_done;
+} rbuffer_uring_req_t;
+
+/*!
+ * @brief Structure representing an io_uring drain.
+ * @note Requests are kept in a FIFO in ring buffer order. Completions may
+ * arrive in any order, but data is only discarded from the ring buffer for the
+ * completed prefix of the FIFO, so ridx never skips over unwritten data.
+ * The submission and completion rings are shared with the kernel: the kernel
+ * advances the SQ head and the CQ tail, this module the SQ tail and the CQ
+ * head. Each request has at most one write outstanding, and the CQ has twice
+ * as many entries as the SQ, so completions never overflow.
+ */
+struct rbuffer_uring_t
+{
+    int ring_fd;
+    void *p_sq_map;             /* Also holds the CQ with a single mapping. */
+    size_t sq_map_len;
+    void *p_cq_map;
+    size_t cq_map_len;
+    struct io_uring_sqe *p_sqes;
+    size_t sqes_len;
+    uint32_t *p_sq_head;
+    uint32_t *p_sq_tail;
+    uint32_t *p_sq_array;
+    uint32_t sq_mask;
+    uint32_t sq_entries;
+    uint32_t sq_tail;           /* Published to the kernel on submission. */
+    uint32_t sq_pending;        /* Prepared, not yet taken by the kernel. */
+    uint32_t *p_cq_head;
+    uint32_t *p_cq_tail;
+    uint32_t cq_mask;
+    struct io_uring_cqe *p_cqes;
+    uint32_t outstanding;       /* Writes prepared whose completion is unseen. */
+
+    rbuffer_uring_req_t *p_reqs;
+    uint32_t depth;
+    uint32_t head;      /* Index of the oldest request. */
+    uint32_t count;     /* Number of requests in the FIFO. */
+    uint32_t inflight;  /* Ring buffer elements covered by the FIFO. */
+    off_t offset;       /* File offset of the next submission. */
+    int fd;
+    int error;          /* First unrecoverable error (negative errno). */
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static int rbuffer_uring_setup(rbuffer_uring_t *p_ur, uint32_t entries);
+static void rbuffer_uring_unmap(rbuffer_uring_t *p_ur);
+static int rbuffer_uring_queue(rbuffer_uring_t *p_ur,
+                               const rbuffer_uring_req_t *p_req);
+static int rbuffer_uring_enter(rbuffer_uring_t *p_ur, uint32_t min_complete);
+static struct io_uring_cqe* rbuffer_uring_peek(const rbuffer_uring_t *p_ur);
+static void rbuffer_uring_seen(rbuffer_uring_t *p_ur);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates an io_uring drain writing to a file.
+ * @param[in] fd File descriptor of the destination file.
+ * @param[in] offset File offset of the first byte to write.
+ * @param[in] queue_depth Maximum number of writes in flight.
+ * @return Pointer to the created drain, or NULL if queue_depth is 0, or if
+ * memory allocation or io_uring setup fails.
+ * @note Time complexity: O(1)
+ * @note io_uring setup fails with errno ENOSYS or EPERM on kernels without
+ * io_uring or where it is disabled; the caller can then keep draining with
+ * rbuffer_drain_to_fd().
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling rbuffer_uring_destroy().
+ */
+rbuffer_uring_t* rbuffer_uring_create(int fd, off_t offset,
+                                      uint32_t queue_depth)
+{
+    if (queue_depth < 1)
+    {
+        return NULL;
+    }
+
+    rbuffer_uring_t *p_ur = calloc(1, sizeof(rbuffer_uring_t));
+    if (NULL == p_ur)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_ur->p_reqs = malloc(queue_depth * sizeof(rbuffer_uring_req_t));
+    if (NULL == p_ur->p_reqs)
+    {
+        free(p_ur);
+        return NULL;
+    }
+
+    int ret = rbuffer_uring_setup(p_ur, queue_depth);
+    if (ret < 0)
+    {
+        free(p_ur->p_reqs);
+        free(p_ur);
+        errno = -ret;
+        return NULL;
+    }
+
+    p_ur->depth = queue_depth;
+    p_ur->head = 0;
+    p_ur->count = 0;
+    p_ur->inflight = 0;
+    p_ur->offset = offset;
+    p_ur->fd = fd;
+    p_ur->error = 0;
+
+    return p_ur;
+} /* End of rbuffer_uring_create() */
+
+/*!
+ * @brief Submits writes for the data that is not yet in flight.
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ * @param[in] p_rb Pointer to the ring buffer to drain.
+ * @return Number of writes submitted, or a negative errno value on failure
+ * (-EINVAL if an argument is NULL).
+ * @note Time complexity: O(d), where d is the queue depth; all writes are
+ * submitted with a single system call.
+ * @note Nothing is removed from p_rb here. Until rbuffer_uring_reap() has
+ * released it, data in flight must not be read, cleared or overwritten, so the
+ * producer must check rbuffer_free_count() before writing. Do not mix with
+ * rbuffer_drain_to_fd() on the same buffer.
+ */
+int rbuffer_uring_submit(rbuffer_uring_t *p_ur, const rbuffer_t *p_rb)
+{
+    if (NULL == p_ur || NULL == p_rb)
+    {
+        return -EINVAL;
+    }
+
+    if (0 != p_ur->error)
+    {
+        return p_ur->error;
+    }
+
+    rbuffer_segment_t segs[2];
+    uint32_t seg_count = rbuffer_peek_segments(p_rb, p_ur->inflight, segs);
+    int queued = 0;
+    bool b_sq_full = false;
+
+    for (uint32_t i = 0; (i < seg_count) && !b_sq_full; i++)
+    {
+        const int32_t *p_data = segs[i].p_data;
+        uint32_t remaining = segs[i].count;
+
+        while (remaining > 0)
+        {
+            if (p_ur->count >= p_ur->depth)
+            {
+                b_sq_full = true;
+                break;
+            }
+
+            uint32_t count = URING_CHUNK_BYTES / sizeof(int32_t);
+            if (count > remaining)
+            {
+                count = remaining;
+            }
+
+            rbuffer_uring_req_t *p_req =
+                &p_ur->p_reqs[(p_ur->head + p_ur->count) % p_ur->depth];
+            p_req->p_base = (const uint8_t *)p_data;
+            p_req->offset = p_ur->offset;
+            p_req->bytes = count * sizeof(int32_t);
+            p_req->done = 0;
+            p_req->count = count;
+            p_req->b_done = false;
+
+            if (rbuffer_uring_queue(p_ur, p_req) < 0)
+            {
+                /* Submission queue full: send what is queued so far. */
+                b_sq_full = true;
+                break;
+            }
+
+            p_ur->count++;
+            p_ur->inflight += count;
+            p_ur->offset += p_req->bytes;
+            p_data += count;
+            remaining -= count;
+            queued++;
+        }
+    }
+
+    if (queued > 0)
+    {
+        int ret = rbuffer_uring_enter(p_ur, 0);
+        if (ret < 0)
+        {
+            p_ur->error = ret;
+            return ret;
+        }
+    }
+
+    return queued;
+} /* End of rbuffer_uring_submit() */
+
+/*!
+ * @brief Processes completed writes and removes the written data from the
+ * ring buffer.
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ * @param[in,out] p_rb Pointer to the ring buffer given to the submit call.
+ * @param[in] b_wait Whether to block until at least one write completes when
+ * writes are in flight.
+ * @return Number of elements removed from p_rb, or a negative errno value on
+ * failure (-EINVAL if an argument is NULL).
+ * @note Time complexity: O(c), where c is the number of completions.
+ * @note Short writes are resubmitted for the remaining bytes. A failed write
+ * makes the drain unusable; the error is returned by every later call.
+ */
+int rbuffer_uring_reap(rbuffer_uring_t *p_ur, rbuffer_t *p_rb, bool b_wait)
+{
+    if (NULL == p_ur || NULL == p_rb)
+    {
+        return -EINVAL;
+    }
+
+    if (0 != p_ur->error)
+    {
+        return p_ur->error;
+    }
+
+    if (0 == p_ur->count)
+    {
+        /* Nothing in flight. */
+        return 0;
+    }
+
+    struct io_uring_cqe *p_cqe = rbuffer_uring_peek(p_ur);
+    if ((NULL == p_cqe) && b_wait)
+    {
+        int ret = rbuffer_uring_enter(p_ur, 1);
+        if (ret < 0)
+        {
+            p_ur->error = ret;
+            return ret;
+        }
+        p_cqe = rbuffer_uring_peek(p_ur);
+    }
+
+    bool b_resubmit = false;
+
+    while (NULL != p_cqe)
+    {
+        rbuffer_uring_req_t *p_req =
+            (rbuffer_uring_req_t *)(uintptr_t)p_cqe->user_data;
+        int res = p_cqe->res;
+        rbuffer_uring_seen(p_ur);
+
+        if ((-EINTR == res) || (-EAGAIN == res))
+        {
+            /* Transient failure: try the same bytes again. */
+            res = 0;
+        }
+        else if (res <= 0)
+        {
+            p_ur->error = (0 == res) ? -EIO : res;
+            return p_ur->error;
+        }
+
+        p_req->done += (uint32_t)res;
+        if (p_req->done < p_req->bytes)
+        {
+            if (rbuffer_uring_queue(p_ur, p_req) < 0)
+            {
+                p_ur->error = -EBUSY;
+                return p_ur->error;
+            }
+            b_resubmit = true;
+        }
+        else
+        {
+            p_req->b_done = true;
+        }
+
+        p_cqe = rbuffer_uring_peek(p_ur);
+    }
+
+    if (b_resubmit)
+    {
+        int ret = rbuffer_uring_enter(p_ur, 0);
+        if (ret < 0)
+        {
+            p_ur->error = ret;
+            return ret;
+        }
+    }
+
+    /* Release the completed prefix, in ring buffer order. */
+    uint32_t released = 0;
+    while ((p_ur->count > 0) && p_ur->p_reqs[p_ur->head].b_done)
+    {
+        uint32_t count = p_ur->p_reqs[p_ur->head].count;
+
+        released += rbuffer_discard(p_rb, count);
+        p_ur->inflight -= count;
+        p_ur->head = (p_ur->head + 1) % p_ur->depth;
+        p_ur->count--;
+    }
+
+    return (int)released;
+} /* End of rbuffer_uring_reap() */
+
+/*!
+ * @brief Writes out all data currently in the ring buffer and waits for it.
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ * @param[in,out] p_rb Pointer to the ring buffer to drain.
+ * @return 0 on success, or a negative errno value on failure.
+ * @note Time complexity: O(n), where n is the number of data in the ring
+ * buffer.
+ */
+int rbuffer_uring_flush(rbuffer_uring_t *p_ur, rbuffer_t *p_rb)
+{
+    while (true)
+    {
+        int ret = rbuffer_uring_submit(p_ur, p_rb);
+        if (ret < 0)
+        {
+            return ret;
+        }
+
+        if (0 == p_ur->count)
+        {
+            /* Everything submitted has been written and released. */
+            return 0;
+        }
+
+        ret = rbuffer_uring_reap(p_ur, p_rb, true);
+        if (ret < 0)
+        {
+            return ret;
+        }
+    }
+} /* End of rbuffer_uring_flush() */
+
+/*!
+ * @brief Returns the number of ring buffer elements covered by writes that
+ * have not been released yet.
+ * @param[in] p_ur Pointer to the io_uring drain.
+ * @return Number of elements in flight. Returns 0 if p_ur is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t rbuffer_uring_inflight(const rbuffer_uring_t *p_ur)
+{
+    if (NULL == p_ur)
+    {
+        return 0;
+    }
+
+    return p_ur->inflight;
+} /* End of rbuffer_uring_inflight() */
+
+/*!
+ * @brief Destroys an io_uring drain and releases all associated resources.
+ * @param[in] p_ur Pointer to the io_uring drain.
+ * @note Writes still in flight are waited for, so the kernel never reads from
+ * a ring buffer that is destroyed afterwards. Their data is not released from
+ * the ring buffer; call rbuffer_uring_flush() first to do so.
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void rbuffer_uring_destroy(rbuffer_uring_t *p_ur)
+{
+    if (NULL == p_ur)
+    {
+        return;
+    }
+
+    /* Wait for the kernel to finish with every submitted buffer. */
+    while (p_ur->outstanding > 0)
+    {
+        if (NULL != rbuffer_uring_peek(p_ur))
+        {
+            rbuffer_uring_seen(p_ur);
+        }
+        else if (rbuffer_uring_enter(p_ur, 1) < 0)
+        {
+            break;
+        }
+    }
+
+    rbuffer_uring_unmap(p_ur);
+    close(p_ur->ring_fd);
+    free(p_ur->p_reqs);
+    free(p_ur);
+} /* End of rbuffer_uring_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Creates the io_uring instance and maps its rings.
+ * @param[in,out] p_ur Pointer to the io_uring drain, zero-initialized.
+ * @param[in] entries Minimum number of submission queue entries.
+ * @return 0 on success, or a negative errno value on failure, in which case
+ * nothing is left open or mapped.
+ */
+static int rbuffer_uring_setup(rbuffer_uring_t *p_ur, uint32_t entries)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring_fd < 0)
+    {
+        return -errno;
+    }
+
+    p_ur->ring_fd = ring_fd;
+    p_ur->sq_map_len = params.sq_off.array +
+                       (params.sq_entries * sizeof(uint32_t));
+    p_ur->cq_map_len = params.cq_off.cqes +
+                       (params.cq_entries * sizeof(struct io_uring_cqe));
+    p_ur->sqes_len = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    bool b_single = (0 != (params.features & IORING_FEAT_SINGLE_MMAP));
+    if (b_single)
+    {
+        /* One mapping holds both rings. */
+        if (p_ur->cq_map_len > p_ur->sq_map_len)
+        {
+            p_ur->sq_map_len = p_ur->cq_map_len;
+        }
+        p_ur->cq_map_len = p_ur->sq_map_len;
+    }
+
+    p_ur->p_sq_map = mmap(NULL, p_ur->sq_map_len, PROT_READ | PROT_WRITE,
+                          MAP_SHARED, ring_fd, IORING_OFF_SQ_RING);
+    if (MAP_FAILED == p_ur->p_sq_map)
+    {
+        p_ur->p_sq_map = NULL;
+    }
+    else if (b_single)
+    {
+        p_ur->p_cq_map = p_ur->p_sq_map;
+    }
+    else
+    {
+        p_ur->p_cq_map = mmap(NULL, p_ur->cq_map_len, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, ring_fd, IORING_OFF_CQ_RING);
+        if (MAP_FAILED == p_ur->p_cq_map)
+        {
+            p_ur->p_cq_map = NULL;
+        }
+    }
+
+    void *p_sqes = mmap(NULL, p_ur->sqes_len, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, ring_fd, IORING_OFF_SQES);
+    p_ur->p_sqes = (MAP_FAILED == p_sqes) ? NULL : p_sqes;
+
+    if ((NULL == p_ur->p_sq_map) || (NULL == p_ur->p_cq_map) ||
+        (NULL == p_ur->p_sqes))
+    {
+        int err = errno;
+        rbuffer_uring_unmap(p_ur);
+        close(ring_fd);
+        return -err;
+    }
+
+    uint8_t *p_sq = p_ur->p_sq_map;
+    uint8_t *p_cq = p_ur->p_cq_map;
+
+    p_ur->p_sq_head = (uint32_t *)(p_sq + params.sq_off.head);
+    p_ur->p_sq_tail = (uint32_t *)(p_sq + params.sq_off.tail);
+    p_ur->p_sq_array = (uint32_t *)(p_sq + params.sq_off.array);
+    p_ur->sq_mask = *(uint32_t *)(p_sq + params.sq_off.ring_mask);
+    p_ur->sq_entries = params.sq_entries;
+    p_ur->sq_tail = *p_ur->p_sq_tail;
+    p_ur->sq_pending = 0;
+    p_ur->p_cq_head = (uint32_t *)(p_cq + params.cq_off.head);
+    p_ur->p_cq_tail = (uint32_t *)(p_cq + params.cq_off.tail);
+    p_ur->cq_mask = *(uint32_t *)(p_cq + params.cq_off.ring_mask);
+    p_ur->p_cqes = (struct io_uring_cqe *)(p_cq + params.cq_off.cqes);
+    p_ur->outstanding = 0;
+
+    return 0;
+} /* End of rbuffer_uring_setup() */
+
+/*!
+ * @brief Unmaps whichever rings are mapped.
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ */
+static void rbuffer_uring_unmap(rbuffer_uring_t *p_ur)
+{
+    if (NULL != p_ur->p_sqes)
+    {
+        munmap(p_ur->p_sqes, p_ur->sqes_len);
+    }
+
+    if ((NULL != p_ur->p_cq_map) && (p_ur->p_cq_map != p_ur->p_sq_map))
+    {
+        munmap(p_ur->p_cq_map, p_ur->cq_map_len);
+    }
+
+    if (NULL != p_ur->p_sq_map)
+    {
+        munmap(p_ur->p_sq_map, p_ur->sq_map_len);
+    }
+
+    p_ur->p_sqes = NULL;
+    p_ur->p_cq_map = NULL;
+    p_ur->p_sq_map = NULL;
+} /* End of rbuffer_uring_unmap() */
+
+/*!
+ * @brief Prepares a write for the unwritten bytes of a request.
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ * @param[in] p_req Request to write; its address is the completion tag.
+ * @return 0 on success, or -EBUSY if the submission queue is full.
+ * @note The write is only seen by the kernel after rbuffer_uring_enter().
+ */
+static int rbuffer_uring_queue(rbuffer_uring_t *p_ur,
+                               const rbuffer_uring_req_t *p_req)
+{
+    uint32_t head = __atomic_load_n(p_ur->p_sq_head, __ATOMIC_ACQUIRE);
+    if ((p_ur->sq_tail - head) >= p_ur->sq_entries)
+    {
+        return -EBUSY;
+    }
+
+    uint32_t idx = p_ur->sq_tail & p_ur->sq_mask;
+    struct io_uring_sqe *p_sqe = &p_ur->p_sqes[idx];
+
+    memset(p_sqe, 0, sizeof(*p_sqe));
+    p_sqe->opcode = IORING_OP_WRITE;
+    p_sqe->fd = p_ur->fd;
+    p_sqe->addr = (uint64_t)(uintptr_t)(p_req->p_base + p_req->done);
+    p_sqe->len = p_req->bytes - p_req->done;
+    p_sqe->off = (uint64_t)(p_req->offset + p_req->done);
+    p_sqe->user_data = (uint64_t)(uintptr_t)p_req;
+
+    p_ur->p_sq_array[idx] = idx;
+    p_ur->sq_tail++;
+    p_ur->sq_pending++;
+    p_ur->outstanding++;
+
+    return 0;
+} /* End of rbuffer_uring_queue() */
+
+/*!
+ * @brief Hands the prepared writes to the kernel and optionally waits for
+ * completions.
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ * @param[in] min_complete Number of completions to wait for; 0 to not wait.
+ * @return 0 on success, or a negative errno value on failure.
+ * @note All prepared writes go in a single io_uring_enter() call, which also
+ * does the waiting. EINTR is retried.
+ */
+static int rbuffer_uring_enter(rbuffer_uring_t *p_ur, uint32_t min_complete)
+{
+    /* Publish the prepared entries before the kernel reads the tail. */
+    __atomic_store_n(p_ur->p_sq_tail, p_ur->sq_tail, __ATOMIC_RELEASE);
+
+    while ((p_ur->sq_pending > 0) || (min_complete > 0))
+    {
+        unsigned int flags = (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0U;
+        long ret = syscall(__NR_io_uring_enter, p_ur->ring_fd,
+                           p_ur->sq_pending, min_complete, flags, NULL, 0);
+        if (ret < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return -errno;
+        }
+
+        p_ur->sq_pending -= (uint32_t)ret;
+        if ((0 == ret) && (0 == min_complete))
+        {
+            /* Nothing was taken; leave the rest for the next call. */
+            break;
+        }
+        min_complete = 0;
+    }
+
+    return 0;
+} /* End of rbuffer_uring_enter() */
+
+/*!
+ * @brief Returns the oldest unseen completion without consuming it.
+ * @param[in] p_ur Pointer to the io_uring drain.
+ * @return Pointer to the completion, or NULL if there is none.
+ */
+static struct io_uring_cqe* rbuffer_uring_peek(const rbuffer_uring_t *p_ur)
+{
+    uint32_t head = __atomic_load_n(p_ur->p_cq_head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(p_ur->p_cq_tail, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+    {
+        return NULL;
+    }
+
+    return &p_ur->p_cqes[head & p_ur->cq_mask];
+} /* End of rbuffer_uring_peek() */
+
+/*!
+ * @brief Consumes the completion returned by rbuffer_uring_peek().
+ * @param[in,out] p_ur Pointer to the io_uring drain.
+ * @note The completion must not be accessed afterwards: the kernel may reuse
+ * its slot.
+ */
+static void rbuffer_uring_seen(rbuffer_uring_t *p_ur)
+{
+    uint32_t head = __atomic_load_n(p_ur->p_cq_head, __ATOMIC_RELAXED);
+
+    __atomic_store_n(p_ur->p_cq_head, head + 1U, __ATOMIC_RELEASE);
+    p_ur->outstanding--;
+} /* End of rbuffer_uring_seen() */
+
+/*** End of file: rbuffer_uring.c */
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ *
+ * @file    rbuffer_uring.h
+ * @brief   Public APIs for draining a ring buffer to a file with io_uring.
+ * @details This optional module submits the filled segments of an rbuffer_t as
+ *          asynchronous writes, so the thread draining the ring does not block
+ *          in write(). Data is only removed from the ring (ridx advanced) once
+ *          the kernel reports its write as complete.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Talks to the kernel through the io_uring_setup() and
+ *          io_uring_enter() system calls directly, so liburing is not needed;
+ *          Linux 5.6 or later is. Build from the module root (e.g.,
+ *          datastructures-and-algorithms/rbuffer) with:
+ *          $ gcc rbuffer.c rbuffer_uring.c <app>.c
+ *
+ ******************************************************************************/
+
+#ifndef RBUFFER_URING_H
+#define RBUFFER_URING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include "rbuffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct rbuffer_uring_t rbuffer_uring_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+rbuffer_uring_t* rbuffer_uring_create(int fd, off_t offset,
+                                      uint32_t queue_depth);
+int rbuffer_uring_submit(rbuffer_uring_t *p_ur, const rbuffer_t *p_rb);
+int rbuffer_uring_reap(rbuffer_uring_t *p_ur, rbuffer_t *p_rb, bool b_wait);
+int rbuffer_uring_flush(rbuffer_uring_t *p_ur, rbuffer_t *p_rb);
+uint32_t rbuffer_uring_inflight(const rbuffer_uring_t *p_ur);
+void rbuffer_uring_destroy(rbuffer_uring_t *p_ur);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RBUFFER_URING_H */
+
+/*** End of file: rbuffer_uring.h */
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ *
+ * @file    static_ring.hpp
+ * @brief   Header-only ring buffer with a compile-time capacity.
+ * @details dsa::static_ring<T, N> follows the rbuffer.h semantics (a write to
+ *          a full ring overwrites the oldest element) but stores its elements
+ *          inline, so it can live on the stack or in static storage without
+ *          any heap allocation. Because N is a template parameter, the wrap
+ *          check is folded at compile time: a power-of-two N wraps with a
+ *          mask, any other N with a single compare. All operations are
+ *          constexpr.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    T must be default constructible; all N slots are constructed up
+ *          front, just as rbuffer_t's buffer is allocated up front.
+ *
+ ******************************************************************************/
+
+#ifndef STATIC_RING_HPP
+#define STATIC_RING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+/*!
+ * @brief Fixed-capacity ring buffer.
+ * @tparam T Element type.
+ * @tparam N Maximum number of elements the ring can store (at least 1).
+ */
+template <typename T, std::uint32_t N>
+class static_ring
+{
+    static_assert(N >= 1, "static_ring capacity must be at least 1");
+
+public:
+    using value_type = T;
+    using size_type = std::uint32_t;
+
+    static constexpr size_type capacity = N;
+
+    constexpr static_ring() = default;
+
+    /*!
+     * @brief Reads and removes the oldest element.
+     * @param[out] data Receives the oldest element.
+     * @return true If an element was read.
+     * @return false If the ring is empty.
+     * @note Time complexity: O(1)
+     */
+    constexpr bool read(T &data) noexcept(
+        std::is_nothrow_move_assignable_v<T>)
+    {
+        if (0 == m_count)
+        {
+            return false;
+        }
+
+        data = std::move(m_buf[m_ridx]);
+        m_ridx = wrap(m_ridx + 1);
+        m_count--;
+
+        return true;
+    }
+
+    /*!
+     * @brief Writes an element; if the ring is full, the oldest element is
+     * overwritten.
+     * @param[in] data Element to copy or move into the ring.
+     * @note Time complexity: O(1)
+     * @note The element is assigned before the ring's count and indices are
+     * updated, so if T's assignment throws, the ring still holds the same
+     * elements. If the ring was full, the oldest one is left as the failed
+     * assignment leaves it.
+     */
+    constexpr void write(const T &data)
+    {
+        m_buf[wrap(m_ridx + m_count)] = data;
+        commit_write();
+    }
+
+    constexpr void write(T &&data)
+    {
+        m_buf[wrap(m_ridx + m_count)] = std::move(data);
+        commit_write();
+    }
+
+    /*!
+     * @brief Returns a pointer to the oldest element without removing it.
+     * @return Pointer to the oldest element, or nullptr if the ring is empty.
+     * @note Time complexity: O(1)
+     */
+    constexpr const T* peek() const noexcept
+    {
+        return (0 == m_count) ? nullptr : &m_buf[m_ridx];
+    }
+
+    constexpr size_type data_count() const noexcept { return m_count; }
+    constexpr size_type free_count() const noexcept { return N - m_count; }
+    constexpr bool is_empty() const noexcept { return 0 == m_count; }
+    constexpr bool is_full() const noexcept { return N == m_count; }
+
+    /*!
+     * @brief Discards all elements.
+     * @note Time complexity: O(1). The slots keep their old values until they
+     * are overwritten.
+     */
+    constexpr void clear() noexcept
+    {
+        m_ridx = 0;
+        m_count = 0;
+    }
+
+private:
+    static constexpr bool b_is_pow2 = (0 == (N & (N - 1)));
+
+    /*!
+     * @brief Maps an index in [0, 2N) to [0, N).
+     */
+    static constexpr size_type wrap(size_type idx) noexcept
+    {
+        if constexpr (b_is_pow2)
+        {
+            return idx & (N - 1);
+        }
+        else
+        {
+            return (idx >= N) ? (idx - N) : idx;
+        }
+    }
+
+    /*!
+     * @brief Publishes the slot just written, dropping the oldest element if
+     * the ring is full.
+     */
+    constexpr void commit_write() noexcept
+    {
+        if (N == m_count)
+        {
+            /* Ring full: the oldest element has been overwritten. */
+            m_ridx = wrap(m_ridx + 1);
+        }
+        else
+        {
+            m_count++;
+        }
+    }
+
+    T m_buf[N]{};
+    size_type m_ridx = 0;
+    size_type m_count = 0;
+};
+
+} /* namespace dsa */
+
+#endif /* STATIC_RING_HPP */
+
+/*** End of file: static_ring.hpp ***/
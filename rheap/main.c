@@ -0,0 +1,50 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the radix heap module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "rheap.h"
+
+int main(int argc, char *argv[])
+{
+    uint32_t key;
+    int32_t data;
+
+    rheap_t *p_heap = rheap_create();
+    printf("%d\n", rheap_is_empty(p_heap)); /* 1 */
+
+    /* Tentative distances from a source node, as in Dijkstra's algorithm. */
+    rheap_push(p_heap, 7, 1);
+    rheap_push(p_heap, 2, 2);
+    rheap_push(p_heap, 9, 3);
+    rheap_push(p_heap, 4, 4);
+    printf("%u\n", rheap_size(p_heap)); /* 4 */
+
+    rheap_pop_min(p_heap, &key, &data);
+    printf("%u %d\n", key, data); /* 2 2 */
+
+    /* Relaxing edges of node 2 only yields keys of at least 2. */
+    rheap_push(p_heap, 3, 5);
+    printf("%d\n", rheap_push(p_heap, 1, 6)); /* 0 */
+
+    while (rheap_pop_min(p_heap, &key, &data))
+    {
+        printf("%u:%d ", key, data);
+    }
+    printf("\n"); /* 3:5 4:4 7:1 9:3 */
+
+    printf("%u\n", rheap_last_key(p_heap)); /* 9 */
+    rheap_clear(p_heap);
+    printf("%u\n", rheap_last_key(p_heap)); /* 0 */
+
+    rheap_destroy(p_heap);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
@@ -0,0 +1,479 @@
+/*******************************************************************************
+ *
+ * @file    rheap.c
+ * @brief   Implementation of a radix heap.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definitions of rheap_t and rheap_block_t are intentionally kept
+ *          private to this source file to enforce encapsulation. Users of this
+ *          module interact with the heap only through the public API and
+ *          cannot access or modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "rheap.h"
+#include <stdlib.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define RHEAP_BUCKET_COUNT  (33U)   /* Bucket 0, plus one per key bit. */
+#define RHEAP_BLOCK_ENTRIES (62U)   /* Entries per block: 512 bytes a block. */
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Element of the heap.
+ */
+typedef struct
+{
+    uint32_t key;
+    int32_t data;
+} rheap_entry_t;
+
+/*!
+ * @brief Node of a bucket list, holding up to RHEAP_BLOCK_ENTRIES elements.
+ * @note Storing elements in blocks rather than one per node keeps the scans
+ * of a bucket sequential in memory.
+ */
+typedef struct rheap_block_t
+{
+    struct rheap_block_t *p_next;
+    uint32_t count;
+    rheap_entry_t entries[RHEAP_BLOCK_ENTRIES];
+} rheap_block_t;
+
+/*!
+ * @brief Structure representing a radix heap.
+ * @note This structure is opaque to users of the API. Only the head block of a
+ * bucket may be partially filled. Bit i of nonempty is set if and only if
+ * buckets[i] holds an element, so the lowest non-empty bucket is found with
+ * one count-trailing-zeros instruction.
+ */
+struct rheap_t
+{
+    rheap_block_t *buckets[RHEAP_BUCKET_COUNT];
+    uint64_t nonempty;
+    uint32_t last;          /* Last popped key; lower bound of all keys. */
+    uint32_t size;
+    rheap_block_t *p_free;  /* Unused blocks, kept for reuse. */
+    uint32_t free_count;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static uint32_t rheap_bucket_of(uint32_t key, uint32_t last);
+static bool rheap_bucket_push(rheap_t *p_heap, uint32_t bucket,
+                              rheap_entry_t entry);
+static bool rheap_reserve(rheap_t *p_heap, uint32_t count);
+static bool rheap_refill(rheap_t *p_heap);
+static void rheap_free_list(rheap_block_t *p_block);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes a radix heap.
+ * @return Pointer to the created heap, or NULL if memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling rheap_destroy().
+ */
+rheap_t* rheap_create(void)
+{
+    /* Zeroed memory leaves every bucket empty and the last key at 0. */
+    rheap_t *p_heap = calloc(1, sizeof(rheap_t));
+    if (NULL == p_heap)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    return p_heap;
+} /* End of rheap_create() */
+
+/*!
+ * @brief Inserts an element.
+ * @param[in,out] p_heap Pointer to the heap.
+ * @param[in] key Priority of the element; smaller keys are popped first.
+ * @param[in] data Data of the element.
+ * @return true If the element was inserted.
+ * @return false If p_heap is NULL, key is smaller than rheap_last_key(), or
+ * memory allocation fails.
+ * @note Time complexity: O(1)
+ */
+bool rheap_push(rheap_t *p_heap, uint32_t key, int32_t data)
+{
+    if (NULL == p_heap)
+    {
+        return false;
+    }
+
+    if (key < p_heap->last)
+    {
+        /* Keys must be monotone. */
+        return false;
+    }
+
+    rheap_entry_t entry = { key, data };
+    if (!rheap_bucket_push(p_heap, rheap_bucket_of(key, p_heap->last), entry))
+    {
+        /* Memory allocation failed. */
+        return false;
+    }
+    p_heap->size++;
+
+    return true;
+} /* End of rheap_push() */
+
+/*!
+ * @brief Removes an element with the smallest key.
+ * @param[in,out] p_heap Pointer to the heap.
+ * @param[out] p_key Optional; receives the key. May be NULL.
+ * @param[out] p_data Optional; receives the data. May be NULL.
+ * @return true If an element was removed.
+ * @return false If p_heap is NULL, the heap is empty, or memory allocation
+ * fails while redistributing a bucket.
+ * @note Time complexity: amortized O(log C), where C is the largest difference
+ * between a pushed key and the last popped key. Elements with equal keys are
+ * popped in no particular order.
+ */
+bool rheap_pop_min(rheap_t *p_heap, uint32_t *p_key, int32_t *p_data)
+{
+    if (!rheap_peek_min(p_heap, p_key, p_data))
+    {
+        return false;
+    }
+
+    /* rheap_peek_min() left the minimum at the end of the head block of
+     * bucket 0. */
+    rheap_block_t *p_block = p_heap->buckets[0];
+    p_block->count--;
+    if (0 == p_block->count)
+    {
+        p_heap->buckets[0] = p_block->p_next;
+        if (NULL == p_heap->buckets[0])
+        {
+            p_heap->nonempty &= ~1ULL;
+        }
+
+        /* Keep the block for reuse. */
+        p_block->p_next = p_heap->p_free;
+        p_heap->p_free = p_block;
+        p_heap->free_count++;
+    }
+    p_heap->size--;
+
+    return true;
+} /* End of rheap_pop_min() */
+
+/*!
+ * @brief Returns an element with the smallest key without removing it.
+ * @param[in,out] p_heap Pointer to the heap.
+ * @param[out] p_key Optional; receives the key. May be NULL.
+ * @param[out] p_data Optional; receives the data. May be NULL.
+ * @return true If the heap is not empty.
+ * @return false If p_heap is NULL, the heap is empty, or memory allocation
+ * fails while redistributing a bucket.
+ * @note Time complexity: amortized O(log C)
+ * @note The heap is modified: if bucket 0 is empty, the next bucket is
+ * redistributed, and rheap_last_key() becomes the returned key.
+ */
+bool rheap_peek_min(rheap_t *p_heap, uint32_t *p_key, int32_t *p_data)
+{
+    if (NULL == p_heap)
+    {
+        return false;
+    }
+
+    if (0 == p_heap->size)
+    {
+        return false;
+    }
+
+    if ((NULL == p_heap->buckets[0]) && !rheap_refill(p_heap))
+    {
+        return false;
+    }
+
+    const rheap_block_t *p_block = p_heap->buckets[0];
+    const rheap_entry_t *p_entry = &p_block->entries[p_block->count - 1U];
+
+    if (NULL != p_key)
+    {
+        *p_key = p_entry->key;
+    }
+    if (NULL != p_data)
+    {
+        *p_data = p_entry->data;
+    }
+
+    return true;
+} /* End of rheap_peek_min() */
+
+/*!
+ * @brief Counts the elements in the heap.
+ * @param[in] p_heap Pointer to the heap.
+ * @return Number of elements. Returns 0 if p_heap is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t rheap_size(const rheap_t *p_heap)
+{
+    if (NULL == p_heap)
+    {
+        return 0;
+    }
+
+    return p_heap->size;
+} /* End of rheap_size() */
+
+/*!
+ * @brief Checks whether the heap is empty.
+ * @param[in] p_heap Pointer to the heap.
+ * @return true If the heap is empty.
+ * @return false If the heap has elements, or p_heap is NULL.
+ * @note Time complexity: O(1)
+ */
+bool rheap_is_empty(const rheap_t *p_heap)
+{
+    if (NULL == p_heap)
+    {
+        return false;
+    }
+
+    return (0 == p_heap->size);
+} /* End of rheap_is_empty() */
+
+/*!
+ * @brief Returns the smallest key that may currently be pushed.
+ * @param[in] p_heap Pointer to the heap.
+ * @return Key of the last popped (or peeked) element, 0 for a new or cleared
+ * heap, or 0 if p_heap is NULL.
+ * @note Time complexity: O(1)
+ */
+uint32_t rheap_last_key(const rheap_t *p_heap)
+{
+    if (NULL == p_heap)
+    {
+        return 0;
+    }
+
+    return p_heap->last;
+} /* End of rheap_last_key() */
+
+/*!
+ * @brief Removes all elements and resets the last key to 0.
+ * @param[in,out] p_heap Pointer to the heap.
+ * @note If p_heap is NULL, the function does nothing.
+ * @note Time complexity: O(b), where b is the number of blocks in use. The
+ * blocks are kept for reuse.
+ */
+void rheap_clear(rheap_t *p_heap)
+{
+    if (NULL == p_heap)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < RHEAP_BUCKET_COUNT; i++)
+    {
+        rheap_block_t *p_block = p_heap->buckets[i];
+
+        while (NULL != p_block)
+        {
+            rheap_block_t *p_next = p_block->p_next;
+            p_block->p_next = p_heap->p_free;
+            p_heap->p_free = p_block;
+            p_heap->free_count++;
+            p_block = p_next;
+        }
+        p_heap->buckets[i] = NULL;
+    }
+
+    p_heap->nonempty = 0;
+    p_heap->last = 0;
+    p_heap->size = 0;
+} /* End of rheap_clear() */
+
+/*!
+ * @brief Destroys a radix heap and releases all associated memory.
+ * @param[in] p_heap Pointer to the heap.
+ * @note Time complexity: O(b), where b is the number of blocks.
+ * @note It is safe to call this function with a NULL pointer.
+ */
+void rheap_destroy(rheap_t *p_heap)
+{
+    if (NULL == p_heap)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < RHEAP_BUCKET_COUNT; i++)
+    {
+        rheap_free_list(p_heap->buckets[i]);
+    }
+    rheap_free_list(p_heap->p_free);
+
+    free(p_heap);
+} /* End of rheap_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Computes the bucket of a key.
+ * @param[in] key Key of the element, not smaller than last.
+ * @param[in] last Last popped key.
+ * @return 0 if key equals last, otherwise 1 + the index of the highest bit in
+ * which key and last differ.
+ */
+static uint32_t rheap_bucket_of(uint32_t key, uint32_t last)
+{
+    uint32_t diff = key ^ last;
+
+    if (0 == diff)
+    {
+        return 0;
+    }
+
+    return 32U - (uint32_t)__builtin_clz(diff);
+} /* End of rheap_bucket_of() */
+
+/*!
+ * @brief Adds an element to the head block of a bucket.
+ * @param[in,out] p_heap Pointer to the heap.
+ * @param[in] bucket Index of the bucket.
+ * @param[in] entry Element to add.
+ * @return true If the element was added.
+ * @return false If a new block was needed and memory allocation failed.
+ * @note Time complexity: O(1)
+ */
+static bool rheap_bucket_push(rheap_t *p_heap, uint32_t bucket,
+                              rheap_entry_t entry)
+{
+    rheap_block_t *p_head = p_heap->buckets[bucket];
+
+    if ((NULL == p_head) || (RHEAP_BLOCK_ENTRIES == p_head->count))
+    {
+        /* Prepend a fresh block, like slist_add_to_head(). */
+        if (!rheap_reserve(p_heap, 1U))
+        {
+            return false;
+        }
+        rheap_block_t *p_new = p_heap->p_free;
+        p_heap->p_free = p_new->p_next;
+        p_heap->free_count--;
+
+        p_new->count = 0;
+        p_new->p_next = p_head;
+        p_heap->buckets[bucket] = p_new;
+        p_head = p_new;
+    }
+
+    p_head->entries[p_head->count++] = entry;
+    p_heap->nonempty |= (1ULL << bucket);
+
+    return true;
+} /* End of rheap_bucket_push() */
+
+/*!
+ * @brief Ensures that a number of unused blocks is available.
+ * @param[in,out] p_heap Pointer to the heap.
+ * @param[in] count Number of blocks needed.
+ * @return true If at least count blocks are unused.
+ * @return false If memory allocation fails.
+ * @note Time complexity: O(count)
+ */
+static bool rheap_reserve(rheap_t *p_heap, uint32_t count)
+{
+    while (p_heap->free_count < count)
+    {
+        rheap_block_t *p_block = malloc(sizeof(rheap_block_t));
+        if (NULL == p_block)
+        {
+            /* Memory allocation failed. */
+            return false;
+        }
+
+        p_block->p_next = p_heap->p_free;
+        p_heap->p_free = p_block;
+        p_heap->free_count++;
+    }
+
+    return true;
+} /* End of rheap_reserve() */
+
+/*!
+ * @brief Refills the empty bucket 0 from the lowest non-empty bucket.
+ * @param[in,out] p_heap Pointer to the heap, which must not be empty.
+ * @return true If bucket 0 holds the minimum on return.
+ * @return false If memory allocation fails; the heap is left unchanged.
+ * @note Time complexity: O(m), where m is the number of elements in the
+ * detached bucket. Every element moves to a strictly lower bucket, which
+ * bounds the total work per element by the number of buckets.
+ */
+static bool rheap_refill(rheap_t *p_heap)
+{
+    /* Each source block adds at most one block per lower bucket. */
+    if ((0 == p_heap->nonempty) || !rheap_reserve(p_heap, RHEAP_BUCKET_COUNT))
+    {
+        return false;
+    }
+
+    uint32_t bucket = (uint32_t)__builtin_ctzll(p_heap->nonempty);
+
+    /* Detach the whole bucket. */
+    rheap_block_t *p_list = p_heap->buckets[bucket];
+    p_heap->buckets[bucket] = NULL;
+    p_heap->nonempty &= ~(1ULL << bucket);
+
+    /* Its smallest key becomes the new reference point. */
+    uint32_t min_key = p_list->entries[0].key;
+    for (const rheap_block_t *p_block = p_list; NULL != p_block;
+         p_block = p_block->p_next)
+    {
+        for (uint32_t i = 0; i < p_block->count; i++)
+        {
+            if (p_block->entries[i].key < min_key)
+            {
+                min_key = p_block->entries[i].key;
+            }
+        }
+    }
+    p_heap->last = min_key;
+
+    while (NULL != p_list)
+    {
+        rheap_block_t *p_next = p_list->p_next;
+
+        for (uint32_t i = 0; i < p_list->count; i++)
+        {
+            rheap_entry_t entry = p_list->entries[i];
+
+            /* Cannot fail: the blocks were reserved above. */
+            (void)rheap_bucket_push(p_heap, rheap_bucket_of(entry.key,
+                                                            min_key), entry);
+        }
+
+        /* The drained block replaces the ones just used. */
+        p_list->p_next = p_heap->p_free;
+        p_heap->p_free = p_list;
+        p_heap->free_count++;
+        p_list = p_next;
+    }
+
+    return true;
+} /* End of rheap_refill() */
+
+/*!
+ * @brief Frees every block of a list.
+ * @param[in] p_block Head of the list, or NULL.
+ */
+static void rheap_free_list(rheap_block_t *p_block)
+{
+    while (NULL != p_block)
+    {
+        rheap_block_t *p_next = p_block->p_next;
+        free(p_block);
+        p_block = p_next;
+    }
+} /* End of rheap_free_list() */
+
+/*** End of file: rheap.c */
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ *
+ * @file    rheap.h
+ * @brief   Public APIs for a radix heap (monotone bucket priority queue).
+ * @details This module provides an opaque min-priority queue for integer keys
+ *          that never decrease over the pops, as in Dijkstra's algorithm: a
+ *          pushed key may not be smaller than the last popped key. Elements
+ *          are kept in 33 buckets, bucket i holding the keys whose highest
+ *          bit differing from the last popped key is bit i - 1. Each bucket
+ *          is a singly linked list like slist_t whose nodes are fixed-size
+ *          blocks of elements, and when the lowest bucket runs dry the next
+ *          non-empty bucket is detached in O(1) and its elements are
+ *          redistributed into lower buckets, so push and pop-min cost
+ *          amortized O(log C) without comparing elements against each other.
+ *          Users must interact with the heap only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Emptied blocks are kept in a free list and only released by
+ *          rheap_destroy(), so a heap that has reached its peak size does not
+ *          call malloc() again.
+ *
+ ******************************************************************************/
+
+#ifndef RHEAP_H
+#define RHEAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct rheap_t rheap_t;
+
+/* Public APIs ---------------------------------------------------------------*/
+
+rheap_t* rheap_create(void);
+bool rheap_push(rheap_t *p_heap, uint32_t key, int32_t data);
+bool rheap_pop_min(rheap_t *p_heap, uint32_t *p_key, int32_t *p_data);
+bool rheap_peek_min(rheap_t *p_heap, uint32_t *p_key, int32_t *p_data);
+uint32_t rheap_size(const rheap_t *p_heap);
+bool rheap_is_empty(const rheap_t *p_heap);
+uint32_t rheap_last_key(const rheap_t *p_heap);
+void rheap_clear(rheap_t *p_heap);
+void rheap_destroy(rheap_t *p_heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RHEAP_H */
+
+/*** End of file: rheap.h */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the ring buffer merge module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          rmerge):
+ *          $ gcc -O2 main.c rmerge.c ../rbuffer/rbuffer.c -o rmerge
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "rmerge.h"
+
+#define STREAM_COUNT    (3)
+#define RING_CAPACITY   (8)
+
+/* Each element is its own timestamp. */
+static uint64_t element_ts(int32_t data, void *p_ctx)
+{
+    (void)p_ctx;
+    return (uint64_t)data;
+}
+
+static void print_merged(rmerge_t *p_merge)
+{
+    int32_t out[16];
+    uint32_t n = rmerge_read(p_merge, out, 16);
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        printf("%d ", out[i]);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    rbuffer_t *rings[STREAM_COUNT];
+
+    for (int i = 0; i < STREAM_COUNT; i++)
+    {
+        rings[i] = rbuffer_create(RING_CAPACITY);
+    }
+
+    rmerge_t *p_merge = rmerge_create(rings, STREAM_COUNT, element_ts, NULL);
+
+    rbuffer_write(rings[0], 10);
+    rbuffer_write(rings[0], 40);
+    rbuffer_write(rings[1], 20);
+    rbuffer_write(rings[1], 30);
+
+    /* Stream 2 is idle and could still produce anything. */
+    print_merged(p_merge); /* (none) */
+
+    /* It promises nothing before 25. */
+    rmerge_set_watermark(p_merge, 2, 25);
+    print_merged(p_merge); /* 10 20 */
+
+    /* Its data arrives; stream 1 is now empty with watermark 30. */
+    rbuffer_write(rings[2], 25);
+    rbuffer_write(rings[2], 35);
+    print_merged(p_merge); /* 25 30 */
+
+    /* Closing the other streams releases the rest. */
+    rmerge_close(p_merge, 1);
+    rmerge_close(p_merge, 2);
+    printf("%d\n", rmerge_is_done(p_merge)); /* 0 */
+    print_merged(p_merge); /* 35 40 */
+    rmerge_close(p_merge, 0);
+    printf("%d\n", rmerge_is_done(p_merge)); /* 1 */
+
+    rmerge_destroy(p_merge);
+    for (int i = 0; i < STREAM_COUNT; i++)
+    {
+        rbuffer_destroy(rings[i]);
+    }
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
@@ -0,0 +1,473 @@
+/*******************************************************************************
+ *
+ * @file    rmerge.c
+ * @brief   Implementation of a timestamp-ordered merge of ring buffer streams.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definitions of rmerge_t and rmerge_stream_t are intentionally
+ *          kept private to this source file to enforce encapsulation. Users of
+ *          this module interact with the merger only through the public API
+ *          and cannot access or modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "rmerge.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief State of one input stream.
+ * @note batch[pos..len) holds the elements already taken from the ring, and
+ * head_ts is the timestamp of batch[pos]. watermark is the lowest timestamp
+ * the stream may still produce: it is raised by rmerge_set_watermark() and by
+ * every element consumed from the stream. key and b_key_data are the key the
+ * stream last played the loser tree with (see rmerge_t).
+ */
+typedef struct
+{
+    rbuffer_t *p_rb;
+    uint32_t pos;
+    uint32_t len;
+    uint64_t head_ts;
+    uint64_t watermark;
+    uint64_t key;
+    bool b_key_data;
+    bool b_closed;
+    int32_t batch[RMERGE_BATCH_SIZE];
+} rmerge_stream_t;
+
+/*!
+ * @brief Structure representing a merger.
+ * @note This structure is opaque to users of the API. p_tree is a loser tree
+ * laid out like a binary heap: stream i is the leaf at position k + i, nodes
+ * 1 to k - 1 hold the stream that lost the match played there, and p_tree[0]
+ * holds the overall winner. The key of a stream is the timestamp of its head
+ * element, or its watermark if it has no data (infinite once closed), so an
+ * idle stream wins exactly when it may still produce the next element.
+ * A key never decreases, so the tree is allowed to hold stale keys: a stream
+ * is re-keyed only when it reaches the root, where replaying its path is
+ * always valid, and a stale key can only make it win too early.
+ */
+struct rmerge_t
+{
+    rmerge_stream_t *p_streams;
+    uint32_t *p_tree;
+    uint32_t k;
+    rmerge_ts_fn_t ts_fn;
+    void *p_ctx;
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool rmerge_refill(rmerge_t *p_merge, rmerge_stream_t *p_stream);
+static bool rmerge_update_key(rmerge_stream_t *p_stream);
+static bool rmerge_beats(const rmerge_t *p_merge, uint32_t a, uint32_t b);
+static void rmerge_replay(rmerge_t *p_merge, uint32_t stream);
+static void rmerge_build(rmerge_t *p_merge, uint32_t *p_win);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates a merger over k ring buffers.
+ * @param[in] rings Array of k ring buffers, one per stream. Each ring must
+ * receive its elements in non-decreasing timestamp order.
+ * @param[in] k Number of streams.
+ * @param[in] ts_fn Function returning the timestamp of an element.
+ * @param[in] p_ctx Context passed to ts_fn. It may be NULL.
+ * @return Pointer to the created merger, or NULL if rings or ts_fn is NULL, k
+ * is 0 or greater than 2^24, any ring is NULL, or any memory allocation fails.
+ * @note Time complexity: O(k)
+ * @note The rings are not owned by the merger and must outlive it. Every
+ * stream starts with a watermark of 0, so the merger emits nothing until each
+ * stream has data, a watermark or has been closed.
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling rmerge_destroy().
+ */
+rmerge_t* rmerge_create(rbuffer_t *const rings[], uint32_t k,
+                        rmerge_ts_fn_t ts_fn, void *p_ctx)
+{
+    if ((NULL == rings) || (NULL == ts_fn) || (0 == k) || (k > (1U << 24)))
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < k; i++)
+    {
+        if (NULL == rings[i])
+        {
+            return NULL;
+        }
+    }
+
+    rmerge_t *p_merge = malloc(sizeof(rmerge_t));
+    if (NULL == p_merge)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_merge->p_streams = malloc(k * sizeof(rmerge_stream_t));
+    p_merge->p_tree = malloc(k * sizeof(uint32_t));
+    uint32_t *p_win = malloc(k * sizeof(uint32_t));
+    if ((NULL == p_merge->p_streams) || (NULL == p_merge->p_tree) ||
+        (NULL == p_win))
+    {
+        free(p_merge->p_streams);
+        free(p_merge->p_tree);
+        free(p_win);
+        free(p_merge);
+        return NULL;
+    }
+
+    p_merge->k = k;
+    p_merge->ts_fn = ts_fn;
+    p_merge->p_ctx = p_ctx;
+
+    for (uint32_t i = 0; i < k; i++)
+    {
+        rmerge_stream_t *p_stream = &p_merge->p_streams[i];
+        p_stream->p_rb = rings[i];
+        p_stream->pos = 0;
+        p_stream->len = 0;
+        p_stream->head_ts = 0;
+        p_stream->watermark = 0;
+        p_stream->key = 0;
+        p_stream->b_key_data = false;
+        p_stream->b_closed = false;
+        (void)rmerge_refill(p_merge, p_stream);
+        (void)rmerge_update_key(p_stream);
+    }
+
+    rmerge_build(p_merge, p_win);
+    free(p_win);
+
+    return p_merge;
+} /* End of rmerge_create() */
+
+/*!
+ * @brief Promises that a stream will produce no element earlier than ts.
+ * @param[in,out] p_merge Pointer to the merger.
+ * @param[in] stream Index of the stream.
+ * @param[in] ts New watermark of the stream.
+ * @return true If the watermark was applied.
+ * @return false If p_merge is NULL or stream is out of range.
+ * @note Time complexity: O(1)
+ * @note A watermark lower than the current one is ignored. Producers of idle
+ * channels call this periodically (e.g., with their clock) so that the other
+ * channels are not held back. Elements written to the ring before the call may
+ * still be earlier than ts.
+ */
+bool rmerge_set_watermark(rmerge_t *p_merge, uint32_t stream, uint64_t ts)
+{
+    if ((NULL == p_merge) || (stream >= p_merge->k))
+    {
+        return false;
+    }
+
+    rmerge_stream_t *p_stream = &p_merge->p_streams[stream];
+    if (ts > p_stream->watermark)
+    {
+        p_stream->watermark = ts;
+    }
+
+    return true;
+} /* End of rmerge_set_watermark() */
+
+/*!
+ * @brief Marks a stream as finished.
+ * @param[in,out] p_merge Pointer to the merger.
+ * @param[in] stream Index of the stream.
+ * @return true If the stream was closed.
+ * @return false If p_merge is NULL or stream is out of range.
+ * @note Time complexity: O(1)
+ * @note Data already written to the ring is still merged. Once drained, the
+ * stream no longer holds back the others.
+ */
+bool rmerge_close(rmerge_t *p_merge, uint32_t stream)
+{
+    if ((NULL == p_merge) || (stream >= p_merge->k))
+    {
+        return false;
+    }
+
+    p_merge->p_streams[stream].b_closed = true;
+
+    return true;
+} /* End of rmerge_close() */
+
+/*!
+ * @brief Reads merged elements in timestamp order.
+ * @param[in,out] p_merge Pointer to the merger.
+ * @param[out] p_out Pointer to the array that receives the elements.
+ * @param[in] max_count Maximum number of elements to read.
+ * @return Number of elements read. Returns 0 if p_merge or p_out is NULL.
+ * @note Time complexity: O(n log k) for n elements read.
+ * @note Reading stops early when the next element could still come from a
+ * stream that has no data, i.e., when an open stream without data has a
+ * watermark below every available element. Elements with equal timestamps
+ * from different streams may come in either order.
+ */
+uint32_t rmerge_read(rmerge_t *p_merge, int32_t *p_out, uint32_t max_count)
+{
+    if ((NULL == p_merge) || (NULL == p_out))
+    {
+        return 0;
+    }
+
+    uint32_t n = 0;
+
+    while (n < max_count)
+    {
+        uint32_t winner = p_merge->p_tree[0];
+        rmerge_stream_t *p_stream = &p_merge->p_streams[winner];
+
+        /* A stream without data may have received some since it was last
+         * looked at. */
+        (void)rmerge_refill(p_merge, p_stream);
+
+        if (rmerge_update_key(p_stream))
+        {
+            /* It won with a stale key: play again with the current one. */
+            rmerge_replay(p_merge, winner);
+            continue;
+        }
+
+        if (p_stream->pos >= p_stream->len)
+        {
+            /* The earliest possible element is yet to be written. */
+            break;
+        }
+
+        p_out[n++] = p_stream->batch[p_stream->pos];
+        if (p_stream->head_ts > p_stream->watermark)
+        {
+            p_stream->watermark = p_stream->head_ts;
+        }
+
+        p_stream->pos++;
+        if (p_stream->pos < p_stream->len)
+        {
+            p_stream->head_ts = p_merge->ts_fn(p_stream->batch[p_stream->pos],
+                                               p_merge->p_ctx);
+        }
+        else
+        {
+            (void)rmerge_refill(p_merge, p_stream);
+        }
+
+        (void)rmerge_update_key(p_stream);
+        rmerge_replay(p_merge, winner);
+    }
+
+    return n;
+} /* End of rmerge_read() */
+
+/*!
+ * @brief Checks whether every stream is closed and fully merged.
+ * @param[in] p_merge Pointer to the merger.
+ * @return true If no element remains and every stream is closed.
+ * @return false If p_merge is NULL, or any stream is open or has data left.
+ * @note Time complexity: O(k)
+ */
+bool rmerge_is_done(const rmerge_t *p_merge)
+{
+    if (NULL == p_merge)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < p_merge->k; i++)
+    {
+        const rmerge_stream_t *p_stream = &p_merge->p_streams[i];
+        if ((!p_stream->b_closed) || (p_stream->pos < p_stream->len) ||
+            (!rbuffer_is_empty(p_stream->p_rb)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+} /* End of rmerge_is_done() */
+
+/*!
+ * @brief Destroys a merger. The rings are left untouched.
+ * @param[in] p_merge Pointer to the merger.
+ * @note Time complexity: O(1)
+ * @note Elements already taken from the rings but not yet read are lost.
+ * @note It is safe to call this function with a NULL pointer.
+ * @note After this function returns, the pointer must not be used again.
+ */
+void rmerge_destroy(rmerge_t *p_merge)
+{
+    if (NULL == p_merge)
+    {
+        return;
+    }
+
+    free(p_merge->p_streams);
+    free(p_merge->p_tree);
+    free(p_merge);
+} /* End of rmerge_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Takes the next batch of a stream from its ring, if the current batch
+ * is used up.
+ * @param[in,out] p_merge Pointer to the merger.
+ * @param[in,out] p_stream Pointer to the stream.
+ * @return true If the stream has data.
+ * @return false If both the batch and the ring are empty.
+ * @note The batch is copied out of the ring's contiguous segments and
+ * discarded in one step, so the ring's indices are touched once per batch
+ * rather than once per element.
+ */
+static bool rmerge_refill(rmerge_t *p_merge, rmerge_stream_t *p_stream)
+{
+    if (p_stream->pos < p_stream->len)
+    {
+        return true;
+    }
+
+    rbuffer_segment_t segs[2];
+    uint32_t seg_count = rbuffer_peek_segments(p_stream->p_rb, 0, segs);
+    uint32_t len = 0;
+
+    for (uint32_t i = 0; (i < seg_count) && (len < RMERGE_BATCH_SIZE); i++)
+    {
+        uint32_t count = segs[i].count;
+        if (count > (RMERGE_BATCH_SIZE - len))
+        {
+            count = RMERGE_BATCH_SIZE - len;
+        }
+        memcpy(&p_stream->batch[len], segs[i].p_data,
+               count * sizeof(int32_t));
+        len += count;
+    }
+
+    p_stream->pos = 0;
+    p_stream->len = len;
+    if (0 == len)
+    {
+        return false;
+    }
+
+    (void)rbuffer_discard(p_stream->p_rb, len);
+    p_stream->head_ts = p_merge->ts_fn(p_stream->batch[0], p_merge->p_ctx);
+
+    return true;
+} /* End of rmerge_refill() */
+
+/*!
+ * @brief Recomputes the key of a stream from its current state.
+ * @param[in,out] p_stream Pointer to the stream.
+ * @return true If the key changed.
+ * @return false Otherwise.
+ */
+static bool rmerge_update_key(rmerge_stream_t *p_stream)
+{
+    bool b_data = (p_stream->pos < p_stream->len);
+    uint64_t key = b_data ? p_stream->head_ts :
+                   (p_stream->b_closed ? UINT64_MAX : p_stream->watermark);
+
+    if ((key == p_stream->key) && (b_data == p_stream->b_key_data))
+    {
+        return false;
+    }
+
+    p_stream->key = key;
+    p_stream->b_key_data = b_data;
+
+    return true;
+} /* End of rmerge_update_key() */
+
+/*!
+ * @brief Decides the match between two streams.
+ * @param[in] p_merge Pointer to the merger.
+ * @param[in] a Index of the first stream.
+ * @param[in] b Index of the second stream.
+ * @return true If stream a comes before stream b.
+ * @return false Otherwise.
+ * @note At equal keys, a stream with data beats one without: a watermark only
+ * rules out earlier elements. Remaining ties go to the lower index.
+ */
+static bool rmerge_beats(const rmerge_t *p_merge, uint32_t a, uint32_t b)
+{
+    const rmerge_stream_t *p_a = &p_merge->p_streams[a];
+    const rmerge_stream_t *p_b = &p_merge->p_streams[b];
+
+    if (p_a->key != p_b->key)
+    {
+        return (p_a->key < p_b->key);
+    }
+
+    if (p_a->b_key_data != p_b->b_key_data)
+    {
+        return p_a->b_key_data;
+    }
+
+    return (a < b);
+} /* End of rmerge_beats() */
+
+/*!
+ * @brief Replays the matches on the path from the winner's leaf to the root
+ * after its key changed.
+ * @param[in,out] p_merge Pointer to the merger.
+ * @param[in] stream Index of the stream, which must be the current winner.
+ * @note Time complexity: O(log k). Only the stored losers on the path are
+ * compared against, one comparison per level: for the winner they are exactly
+ * the winners of the sibling subtrees.
+ */
+static void rmerge_replay(rmerge_t *p_merge, uint32_t stream)
+{
+    uint32_t winner = stream;
+
+    for (uint32_t node = (p_merge->k + stream) >> 1; node > 0; node >>= 1)
+    {
+        uint32_t loser = p_merge->p_tree[node];
+        if (rmerge_beats(p_merge, loser, winner))
+        {
+            p_merge->p_tree[node] = winner;
+            winner = loser;
+        }
+    }
+
+    p_merge->p_tree[0] = winner;
+} /* End of rmerge_replay() */
+
+/*!
+ * @brief Plays every match of the tree bottom-up.
+ * @param[in,out] p_merge Pointer to the merger.
+ * @param[out] p_win Scratch array of k entries receiving the winner of each
+ * node.
+ * @note Time complexity: O(k)
+ */
+static void rmerge_build(rmerge_t *p_merge, uint32_t *p_win)
+{
+    uint32_t k = p_merge->k;
+
+    for (uint32_t node = k - 1U; node > 0; node--)
+    {
+        uint32_t left = 2U * node;
+        uint32_t right = left + 1U;
+        uint32_t a = (left >= k) ? (left - k) : p_win[left];
+        uint32_t b = (right >= k) ? (right - k) : p_win[right];
+
+        if (rmerge_beats(p_merge, a, b))
+        {
+            p_win[node] = a;
+            p_merge->p_tree[node] = b;
+        }
+        else
+        {
+            p_win[node] = b;
+            p_merge->p_tree[node] = a;
+        }
+    }
+
+    p_merge->p_tree[0] = (1U == k) ? 0U : p_win[1];
+} /* End of rmerge_build() */
+
+/*** End of file: rmerge.c */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * @file    rmerge.h
+ * @brief   Public APIs for a timestamp-ordered merge of ring buffer streams.
+ * @details This module merges k ring buffers (rbuffer_t), each holding the
+ *          elements of one channel in non-decreasing timestamp order, into a
+ *          single time-ordered output. The current head of every stream sits
+ *          in a loser tree, so each output element costs O(log k)
+ *          comparisons. Elements are taken from each ring in batches copied
+ *          out of its contiguous segments. A channel with no data holds the
+ *          output back until it receives data, is given a watermark (a
+ *          promise that no earlier element will follow) or is closed.
+ *          Users must interact with the merger only through the provided APIs.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The rings are owned by the caller. They are read from the thread
+ *          calling rmerge_read(), so producers must write to them from that
+ *          thread too, or synchronize with it. Build together with
+ *          ../rbuffer/rbuffer.c.
+ *
+ ******************************************************************************/
+
+#ifndef RMERGE_H
+#define RMERGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../rbuffer/rbuffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+#define RMERGE_BATCH_SIZE   (64U)   /* Elements taken from a ring at once. */
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct rmerge_t rmerge_t;
+
+/* Public data types ---------------------------------------------------------*/
+
+/*!
+ * @brief Function returning the timestamp of an element.
+ * @param[in] data Element read from a ring.
+ * @param[in] p_ctx Context given to rmerge_create().
+ * @return Timestamp of the element.
+ */
+typedef uint64_t (*rmerge_ts_fn_t)(int32_t data, void *p_ctx);
+
+/* Public APIs ---------------------------------------------------------------*/
+
+rmerge_t* rmerge_create(rbuffer_t *const rings[], uint32_t k,
+                        rmerge_ts_fn_t ts_fn, void *p_ctx);
+bool rmerge_set_watermark(rmerge_t *p_merge, uint32_t stream, uint64_t ts);
+bool rmerge_close(rmerge_t *p_merge, uint32_t stream);
+uint32_t rmerge_read(rmerge_t *p_merge, int32_t *p_out, uint32_t max_count);
+bool rmerge_is_done(const rmerge_t *p_merge);
+void rmerge_destroy(rmerge_t *p_merge);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RMERGE_H */
+
+/*** End of file: rmerge.h */
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * @file    bench_inline.c
+ * @brief   Benchmark of the checked list APIs versus the inline fast paths of
+ *          slist_inline.h.
+ * @details A queue of QUEUE_LENGTH elements is cycled ITEM_COUNT times by
+ *          removing the head and appending it at the tail, once with the
+ *          checked APIs and once with the *_fast() variants. The list draws
+ *          its nodes from caller-provided storage (see slist_init()), so the
+ *          difference is not hidden behind malloc() and free().
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          slist):
+ *          $ gcc -O2 -DSLIST_INLINE -I. slist.c bench/bench_inline.c \
+ *                -o bench_inline
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "slist.h"
+
+#ifndef SLIST_INLINE
+#error "Build with -DSLIST_INLINE."
+#endif
+
+#define ITEM_COUNT      (100000000)
+#define QUEUE_LENGTH    (1024)
+
+static slist_storage_t g_storage;
+static slist_node_storage_t g_nodes[QUEUE_LENGTH];
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static slist_t* make_queue(void)
+{
+    slist_t *p_list = slist_init(&g_storage, g_nodes, QUEUE_LENGTH);
+
+    for (int i = 0; i < QUEUE_LENGTH; i++)
+    {
+        slist_add_to_tail(p_list, i);
+    }
+
+    return p_list;
+}
+
+static double bench_checked(int64_t *p_sum)
+{
+    slist_t *p_list = make_queue();
+    int data;
+    double start = now_s();
+
+    for (int i = 0; i < ITEM_COUNT; i++)
+    {
+        slist_remove_head(p_list, &data);
+        *p_sum += data;
+        slist_add_to_tail(p_list, data);
+    }
+
+    double ns = (now_s() - start) * 1e9 / ITEM_COUNT;
+    slist_destroy(p_list);
+
+    return ns;
+}
+
+static double bench_fast(int64_t *p_sum)
+{
+    slist_t *p_list = make_queue();
+    int data;
+    double start = now_s();
+
+    for (int i = 0; i < ITEM_COUNT; i++)
+    {
+        slist_remove_head_fast(p_list, &data);
+        *p_sum += data;
+        slist_add_to_tail_fast(p_list, data);
+    }
+
+    double ns = (now_s() - start) * 1e9 / ITEM_COUNT;
+    slist_destroy(p_list);
+
+    return ns;
+}
+
+int main(void)
+{
+    int64_t checked_sum = 0;
+    int64_t fast_sum = 0;
+    double checked_ns = bench_checked(&checked_sum);
+    double fast_ns = bench_fast(&fast_sum);
+
+    if (checked_sum != fast_sum)
+    {
+        printf("Error: checksum mismatch (%lld != %lld)\n",
+               (long long)checked_sum, (long long)fast_sum);
+        return 1;
+    }
+
+    printf("%-10s %10s\n", "api", "ns/op");
+    printf("%-10s %10.2f\n", "checked", checked_ns);
+    printf("%-10s %10.2f\n", "inline", fast_ns);
+    printf("speedup    %9.2fx\n", checked_ns / fast_ns);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: bench_inline.c ***/
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * @file    bench_slist_hpp.cpp
+ * @brief   Benchmark of dsa::slist versus std::forward_list and slist_t.
+ * @details Each round appends ITEM_COUNT elements at the tail, sums them with
+ *          a range-for loop (std::accumulate for the C++ lists) and removes
+ *          them from the head. std::forward_list has no tail pointer, so it
+ *          appends with insert_after() on a cached iterator. A move-only run
+ *          stores std::unique_ptr<int> to show that no copy is required.
+ *          The variants are interleaved REPEAT_COUNT times and the best time
+ *          is reported, so no variant benefits from the heap state left by
+ *          another.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          slist):
+ *          $ gcc -O2 -c slist.c -o slist.o
+ *          $ g++ -std=c++17 -O2 -I. bench/bench_slist_hpp.cpp slist.o \
+ *                -o bench_slist_hpp
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <forward_list>
+#include <memory>
+#include <numeric>
+
+#include "slist.h"
+#include "slist.hpp"
+
+#define ITEM_COUNT  (1000000)
+#define ROUND_COUNT (10)
+#define REPEAT_COUNT (5)
+
+using bench_clock = std::chrono::steady_clock;
+
+static double elapsed_ns_per_op(bench_clock::time_point start)
+{
+    std::chrono::duration<double> d = bench_clock::now() - start;
+    return d.count() * 1e9 / ((double)ITEM_COUNT * ROUND_COUNT);
+}
+
+static double bench_dsa(std::int64_t &sum)
+{
+    auto start = bench_clock::now();
+
+    for (int r = 0; r < ROUND_COUNT; r++)
+    {
+        dsa::slist<int> list;
+
+        for (int i = 0; i < ITEM_COUNT; i++)
+        {
+            list.add_to_tail(i);
+        }
+        sum += std::accumulate(list.begin(), list.end(), std::int64_t(0));
+        while (list.remove_head())
+        {
+        }
+    }
+
+    return elapsed_ns_per_op(start);
+}
+
+static double bench_forward_list(std::int64_t &sum)
+{
+    auto start = bench_clock::now();
+
+    for (int r = 0; r < ROUND_COUNT; r++)
+    {
+        std::forward_list<int> list;
+        auto tail = list.before_begin();
+
+        for (int i = 0; i < ITEM_COUNT; i++)
+        {
+            tail = list.insert_after(tail, i);
+        }
+        sum += std::accumulate(list.begin(), list.end(), std::int64_t(0));
+        while (!list.empty())
+        {
+            list.pop_front();
+        }
+    }
+
+    return elapsed_ns_per_op(start);
+}
+
+static double bench_c(std::int64_t &sum)
+{
+    auto start = bench_clock::now();
+
+    for (int r = 0; r < ROUND_COUNT; r++)
+    {
+        slist_t *p_list = slist_create();
+        int data;
+
+        for (int i = 0; i < ITEM_COUNT; i++)
+        {
+            slist_add_to_tail(p_list, i);
+        }
+        /* slist_t has no iteration API: sum while removing. */
+        while (slist_remove_head(p_list, &data))
+        {
+            sum += data;
+        }
+        slist_destroy(p_list);
+    }
+
+    return elapsed_ns_per_op(start);
+}
+
+static double bench_move_only(std::int64_t &sum)
+{
+    auto start = bench_clock::now();
+
+    for (int r = 0; r < ROUND_COUNT; r++)
+    {
+        dsa::slist<std::unique_ptr<int>> list;
+        std::unique_ptr<int> p_data;
+
+        for (int i = 0; i < ITEM_COUNT; i++)
+        {
+            list.emplace_tail(new int(i));
+        }
+        while (list.remove_head(p_data))
+        {
+            sum += *p_data;
+        }
+    }
+
+    return elapsed_ns_per_op(start);
+}
+
+int main()
+{
+    double dsa_ns = 1e30;
+    double std_ns = 1e30;
+    double c_ns = 1e30;
+    double move_ns = 1e30;
+
+    for (int rep = 0; rep < REPEAT_COUNT; rep++)
+    {
+        std::int64_t dsa_sum = 0;
+        std::int64_t std_sum = 0;
+        std::int64_t c_sum = 0;
+        std::int64_t move_sum = 0;
+
+        dsa_ns = std::min(dsa_ns, bench_dsa(dsa_sum));
+        std_ns = std::min(std_ns, bench_forward_list(std_sum));
+        c_ns = std::min(c_ns, bench_c(c_sum));
+        move_ns = std::min(move_ns, bench_move_only(move_sum));
+
+        if ((dsa_sum != std_sum) || (dsa_sum != c_sum) ||
+            (dsa_sum != move_sum))
+        {
+            printf("Error: checksum mismatch\n");
+            return 1;
+        }
+    }
+
+    printf("%-28s %10s\n", "list", "ns/element");
+    printf("%-28s %10.2f\n", "dsa::slist<int>", dsa_ns);
+    printf("%-28s %10.2f\n", "std::forward_list<int>", std_ns);
+    printf("%-28s %10.2f\n", "slist_t (C)", c_ns);
+    printf("%-28s %10.2f\n", "dsa::slist<unique_ptr<int>>", move_ns);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: bench_slist_hpp.cpp ***/
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * @file    bench_sort.c
+ * @brief   Benchmark of slist_radix_sort() versus slist_sort() and qsort() on
+ *          an array.
+ * @details ELEM_COUNT random int values, negative ones included, are sorted
+ *          as a list with the LSD radix sort, as a list with the merge sort,
+ *          and as a plain array with qsort(). The sorted sequences are
+ *          compared through a checksum.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          slist):
+ *          $ gcc -O2 -I. slist.c bench/bench_sort.c -o bench_sort
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "slist.h"
+
+#define ELEM_COUNT  (1000000)
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static int cmp_int(int a, int b)
+{
+    return (a > b) - (a < b);
+}
+
+static int cmp_qsort(const void *p_a, const void *p_b)
+{
+    return cmp_int(*(const int *)p_a, *(const int *)p_b);
+}
+
+static uint64_t mix(uint64_t sum, int value)
+{
+    return (sum * 31U) + (uint32_t)value;
+}
+
+static slist_t* build_list(const int *p_values)
+{
+    slist_t *p_list = slist_create();
+
+    for (int i = 0; i < ELEM_COUNT; i++)
+    {
+        slist_add_to_tail(p_list, p_values[i]);
+    }
+
+    return p_list;
+}
+
+static uint64_t drain_list(slist_t *p_list)
+{
+    uint64_t sum = 0;
+    int data;
+
+    while (slist_remove_head(p_list, &data))
+    {
+        sum = mix(sum, data);
+    }
+    slist_destroy(p_list);
+
+    return sum;
+}
+
+int main(void)
+{
+    int *p_values = malloc(ELEM_COUNT * sizeof(int));
+    uint32_t seed = 12345U;
+
+    for (int i = 0; i < ELEM_COUNT; i++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        p_values[i] = (int)seed;
+    }
+
+    slist_t *p_list = build_list(p_values);
+    double start = now_s();
+    slist_radix_sort(p_list);
+    double t_radix = now_s() - start;
+    uint64_t sum_radix = drain_list(p_list);
+
+    p_list = build_list(p_values);
+    start = now_s();
+    slist_sort(p_list, cmp_int);
+    double t_merge = now_s() - start;
+    uint64_t sum_merge = drain_list(p_list);
+
+    start = now_s();
+    qsort(p_values, ELEM_COUNT, sizeof(int), cmp_qsort);
+    double t_qsort = now_s() - start;
+    uint64_t sum_qsort = 0;
+    for (int i = 0; i < ELEM_COUNT; i++)
+    {
+        sum_qsort = mix(sum_qsort, p_values[i]);
+    }
+    free(p_values);
+
+    if ((sum_radix != sum_qsort) || (sum_merge != sum_qsort))
+    {
+        printf("checksum mismatch\n");
+        return 1;
+    }
+
+    printf("sort                   ms (%d elements)\n", ELEM_COUNT);
+    printf("slist_radix_sort()     %8.1f\n", t_radix * 1e3);
+    printf("slist_sort()           %8.1f\n", t_merge * 1e3);
+    printf("qsort() on an array    %8.1f\n", t_qsort * 1e3);
+
+    return 0;
+}
+
+/*** End of file: bench_sort.c ***/
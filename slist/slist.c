@@ -5,41 +5,115 @@
  * @author  Kyungjae Lee
  * @date    Jan 24, 2026
  * @note    The definitions of slist_t and slist_node_t are intentionally kept
- *          private to this source file to enforce encapsulation. Users of this
- *          module interact with the list only through the public API and cannot
- *          access or modify internal members directly.
+ *          private to this module (see slist_inline.h) to enforce
+ *          encapsulation. Users of this module interact with the list only
+ *          through the public API and cannot access or modify internal members
+ *          directly.
  * 
  ******************************************************************************/
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "slist.h"
+#include "slist_inline.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define SLIST_FILE_MAGIC    (0x54534C53U)   /* "SLST" in little endian. */
+#define SLIST_FILE_VERSION  (1U)
+#define SLIST_SAVE_CHUNK    (16384U)        /* Elements per write() call. */
+#define SLIST_DUMP_CHUNK    (65536U)        /* Bytes per write() call. */
+#define SLIST_INT_CHARS     (11U)           /* Longest int: "-2147483648". */
+#define SLIST_MERGE_STACK   (32U)           /* Heads merged without malloc(). */
+#define SLIST_SORT_BINS     (32U)           /* Runs of up to 2^32 nodes. */
+#define SLIST_RADIX_BITS    (8U)
+#define SLIST_RADIX_BUCKETS (1U << SLIST_RADIX_BITS)
 
 /* Private data types --------------------------------------------------------*/
 
 /*!
- * @brief Structure representing a node in a singly linked list.
- * @note This structure is internal to the implementation and must not be
- * accessed directly by users of the API.
+ * @brief Header of a list saved by slist_save().
+ * @note The header is followed by count elements of elem_size bytes each, in
+ * list order and host byte order. The checksum covers the elements only.
  */
-typedef struct slist_node_t
+typedef struct
 {
-   int data;
-   struct slist_node_t *p_next;
-} slist_node_t;
+    uint32_t magic;
+    uint16_t version;
+    uint16_t elem_size;
+    uint64_t count;
+    uint64_t checksum;
+} slist_file_header_t;
+
+_Static_assert(sizeof(slist_t) <= sizeof(slist_storage_t),
+               "SLIST_STORAGE_SIZE is too small for slist_t");
+_Static_assert(sizeof(slist_node_t) <= sizeof(slist_node_storage_t),
+               "SLIST_NODE_STORAGE_SIZE is too small for slist_node_t");
 
 /*!
- * @brief Structure representing a singly linked list.
- * @note This structure is opaque to users of the API. The full definition is
- * hidden to prevent direct access to internal members and to preserve list
- * invariants.
+ * @brief Output state shared by slist_dump() and slist_dump_fd().
+ * @note In buffer mode (fd < 0), output that does not fit is counted in total
+ * but dropped. In fd mode, p_buf is a staging chunk flushed when full.
  */
-struct slist_t
+typedef struct
 {
-   slist_node_t *p_head;
-   slist_node_t *p_tail; /* Enables O(1) push_back(). */
-   unsigned int size;
-};
+    char *p_buf;
+    size_t size;
+    size_t len;     /* Bytes stored in p_buf. */
+    size_t total;   /* Bytes produced so far, stored or not. */
+    int fd;
+    bool b_error;
+} slist_dump_ctx_t;
+
+/*!
+ * @brief Head of one input list in the heap of slist_merge_k().
+ */
+typedef struct
+{
+    slist_node_t *p_node;
+    unsigned int list;      /* Index of the input list; breaks ties. */
+} slist_merge_entry_t;
+
+/* Private data -------------------------------------------------------------*/
+
+/* Two ASCII digits for every value in [0, 99], used by slist_format_int(). */
+static const char g_digit_pairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* Private function prototypes -----------------------------------------------*/
+
+static bool slist_materialize(slist_t *p_list);
+static void slist_unmap(slist_t *p_list);
+static uint64_t slist_checksum(uint64_t sum, const int *p_data, size_t count);
+static bool slist_write_all(int fd, const void *p_data, size_t bytes);
+static void slist_dump_all(const slist_t *p_list, slist_dump_format_t format,
+                           slist_dump_ctx_t *p_ctx);
+static void slist_dump_emit(slist_dump_ctx_t *p_ctx, const void *p_src,
+                            size_t len);
+static void slist_dump_flush(slist_dump_ctx_t *p_ctx);
+static size_t slist_format_int(int value, char *p_out);
+static bool slist_merge_less(const slist_merge_entry_t *p_a,
+                             const slist_merge_entry_t *p_b,
+                             slist_cmp_fn_t cmp);
+static void slist_merge_sift_down(slist_merge_entry_t *p_heap,
+                                  unsigned int count, unsigned int idx,
+                                  slist_cmp_fn_t cmp);
+static slist_node_t* slist_merge_two(slist_node_t *p_a, slist_node_t *p_b,
+                                     slist_cmp_fn_t cmp);
 
 /* Public API definitions ----------------------------------------------------*/
 
@@ -64,16 +138,66 @@ slist_t* slist_create(void)
     p_list->p_head = NULL;
     p_list->p_tail = NULL;
     p_list->size = 0;
+    p_list->p_mapped = NULL;
+    p_list->p_map = NULL;
+    p_list->map_len = 0;
+    p_list->p_free = NULL;
+    p_list->b_is_static = false;
 
     return p_list;
 } /* End of slist_create() */
 
+/*!
+ * @brief Initializes a singly linked list that never allocates memory.
+ * @param[out] p_storage Memory for the list control structure, e.g., a static
+ * or stack variable.
+ * @param[in] p_nodes Array of node_count nodes the list draws from.
+ * @param[in] node_count Number of nodes in p_nodes; the maximum list size.
+ * @return Pointer to the list, which lives inside p_storage, or NULL if
+ * p_storage or p_nodes is NULL or node_count is 0.
+ * @note Time complexity: O(n), where n is node_count.
+ * @note Adding to a list whose nodes are all in use fails instead of calling
+ * malloc(), and removed nodes are recycled, so every operation has a fixed
+ * cost. p_storage and p_nodes must outlive the list; slist_destroy() does not
+ * free them.
+ */
+slist_t* slist_init(slist_storage_t *p_storage, slist_node_storage_t *p_nodes,
+                    unsigned int node_count)
+{
+    if (NULL == p_storage || NULL == p_nodes || 0 == node_count)
+    {
+        return NULL;
+    }
+
+    slist_t *p_list = (slist_t *)p_storage;
+
+    p_list->p_head = NULL;
+    p_list->p_tail = NULL;
+    p_list->size = 0;
+    p_list->p_mapped = NULL;
+    p_list->p_map = NULL;
+    p_list->map_len = 0;
+    p_list->b_is_static = true;
+
+    /* Thread all nodes onto the free list, in array order. */
+    p_list->p_free = NULL;
+    for (unsigned int i = node_count; i > 0; i--)
+    {
+        slist_node_t *p_node = (slist_node_t *)&p_nodes[i - 1];
+        p_node->p_next = p_list->p_free;
+        p_list->p_free = p_node;
+    }
+
+    return p_list;
+} /* End of slist_init() */
+
 /*!
  * @brief Destroys a singly linked list and frees all associated memory.
  * @param[in] p_list Pointer to the singly linked list.
  * @return true If the list was destroyed.
  * @return false If p_list is NULL.
  * @note Time complexity: O(n), where n is the number of nodes.
+ * @note For a list set up by slist_init(), nothing is freed.
  */
 bool slist_destroy(slist_t *p_list)
 {
@@ -83,7 +207,10 @@ bool slist_destroy(slist_t *p_list)
     }
 
     slist_clear(p_list);
-    free(p_list);
+    if (!p_list->b_is_static)
+    {
+        free(p_list);
+    }
 
     return true;
 } /* End of slist_destroy() */
@@ -93,7 +220,8 @@ bool slist_destroy(slist_t *p_list)
  * @param[in,out] p_list Pointer to the singly linked list.
  * @param[in] data Data to add.
  * @return true If the addition was successful.
- * @return false If p_list is NULL or memory allocation fails.
+ * @return false If p_list is NULL or memory allocation fails, or if all nodes
+ * of a list set up by slist_init() are in use.
  * @note Time complexity: O(1)
  */
 bool slist_add_to_head(slist_t *p_list, int data)
@@ -103,11 +231,16 @@ bool slist_add_to_head(slist_t *p_list, int data)
         return false;
     }    
 
+    if (!slist_materialize(p_list))
+    {
+        return false;
+    }
+
     /* Create a node. */
-    slist_node_t *p_new = malloc(sizeof(slist_node_t));
+    slist_node_t *p_new = slist_node_alloc(p_list);
     if (NULL == p_new)
     {
-        /* Memory allocation failed. */
+        /* Memory allocation failed, or no caller-provided node is left. */
         return false;
     }
     p_new->data = data;
@@ -137,7 +270,8 @@ bool slist_add_to_head(slist_t *p_list, int data)
  * @param[in,out] p_list Pointer to the singly linked list.
  * @param[in] data Data to add.
  * @return true If the addition was successful.
- * @return false If p_list is NULL or memory allocation fails.
+ * @return false If p_list is NULL or memory allocation fails, or if all nodes
+ * of a list set up by slist_init() are in use.
  * @note Time complexity: O(1)
  */
 bool slist_add_to_tail(slist_t *p_list, int data)
@@ -147,11 +281,16 @@ bool slist_add_to_tail(slist_t *p_list, int data)
         return false;
     }
 
+    if (!slist_materialize(p_list))
+    {
+        return false;
+    }
+
     /* Create a new node. */
-    slist_node_t *p_new = malloc(sizeof(slist_node_t));
+    slist_node_t *p_new = slist_node_alloc(p_list);
     if (NULL == p_new)
     {
-        /* Memory allocation failed. */
+        /* Memory allocation failed, or no caller-provided node is left. */
         return false;
     }
     p_new->data = data;
@@ -195,6 +334,12 @@ bool slist_peek_head(const slist_t *p_list, int *p_data)
         return false;
     }
 
+    if (NULL != p_list->p_mapped)
+    {
+        *p_data = p_list->p_mapped[0];
+        return true;
+    }
+
     *p_data = p_list->p_head->data;
 
     return true;
@@ -221,6 +366,18 @@ bool slist_remove_head(slist_t *p_list, int *p_data)
         return false;
     }
 
+    if (NULL != p_list->p_mapped)
+    {
+        /* File-backed list: consuming the head is a cursor increment. */
+        *p_data = *p_list->p_mapped++;
+        p_list->size--;
+        if (0 == p_list->size)
+        {
+            slist_unmap(p_list);
+        }
+        return true;
+    }
+
     slist_node_t * p_remove = p_list->p_head;
 
     /* Store the data of the current head node being removed. */
@@ -237,7 +394,7 @@ bool slist_remove_head(slist_t *p_list, int *p_data)
     }
 
     p_list->size--;
-    free(p_remove);
+    slist_node_free(p_list, p_remove);
 
     return true;
 } /* End of slist_remove_head() */
@@ -288,13 +445,15 @@ void slist_clear(slist_t *p_list)
         return;
     }
 
+    slist_unmap(p_list);
+
     slist_node_t *p_remove = p_list->p_head;
 
     /* Free nodes one by one while advancing the p_head. */
     while (NULL != p_remove)
     {
         p_list->p_head = p_remove->p_next;
-        free(p_remove);
+        slist_node_free(p_list, p_remove);
         p_remove = p_list->p_head;
     }
 
@@ -304,6 +463,373 @@ void slist_clear(slist_t *p_list)
     p_list->size = 0;
 } /* End of slist_clear() */
 
+/*!
+ * @brief Inserts a node in sorted position.
+ * @param[in,out] p_list Pointer to a singly linked list sorted by cmp.
+ * @param[in] data Data to insert.
+ * @param[in] cmp Comparison function the list is sorted by.
+ * @return true If the insertion was successful.
+ * @return false If p_list or cmp is NULL or memory allocation fails, or if all
+ * nodes of a list set up by slist_init() are in use.
+ * @note Time complexity: O(n), where n is the number of nodes; O(1) when data
+ * does not order before the tail.
+ * @note The node is inserted after all nodes equivalent to data, so equal
+ * elements keep their insertion order.
+ */
+bool slist_insert_sorted(slist_t *p_list, int data, slist_cmp_fn_t cmp)
+{
+    if (NULL == p_list || NULL == cmp)
+    {
+        return false;
+    }
+
+    if (!slist_materialize(p_list))
+    {
+        return false;
+    }
+
+    if ((0 == p_list->size) || (cmp(data, p_list->p_tail->data) >= 0))
+    {
+        /* Appending in order, the common case for sorted streams. */
+        return slist_add_to_tail(p_list, data);
+    }
+
+    slist_node_t *p_new = slist_node_alloc(p_list);
+    if (NULL == p_new)
+    {
+        /* Memory allocation failed, or no caller-provided node is left. */
+        return false;
+    }
+    p_new->data = data;
+
+    /* Find the last node that does not order after data. */
+    slist_node_t *p_prev = NULL;
+    slist_node_t *p_curr = p_list->p_head;
+    while (cmp(p_curr->data, data) <= 0)
+    {
+        p_prev = p_curr;
+        p_curr = p_curr->p_next;
+    }
+
+    /* p_curr is never NULL here: data orders before the tail. */
+    p_new->p_next = p_curr;
+    if (NULL == p_prev)
+    {
+        p_list->p_head = p_new;
+    }
+    else
+    {
+        p_prev->p_next = p_new;
+    }
+
+    p_list->size++;
+
+    return true;
+} /* End of slist_insert_sorted() */
+
+/*!
+ * @brief Merges sorted lists into the first one.
+ * @param[in,out] lists Array of k distinct lists, each sorted by cmp. On
+ * success, lists[0] holds every node and the other lists are empty.
+ * @param[in] k Number of lists.
+ * @param[in] cmp Comparison function the lists are sorted by.
+ * @return true If the lists were merged.
+ * @return false If lists or cmp is NULL, k is 0, an element of lists is NULL,
+ * lists set up by slist_init() are mixed with other lists, the merged size
+ * would exceed UINT_MAX, or memory allocation fails. The lists are left
+ * unchanged, except that file-backed lists may have been copied into regular
+ * nodes.
+ * @note Time complexity: O(n log k), where n is the total number of nodes.
+ * @note Nodes are relinked, not copied. The current heads are kept in a binary
+ * heap, which needs memory only for more than SLIST_MERGE_STACK lists. Equal
+ * elements keep their order, and those of a lower list index come first.
+ * @note Lists from slist_init() can only be merged with each other, and their
+ * node arrays must then outlive lists[0], which now uses their nodes.
+ */
+bool slist_merge_k(slist_t *lists[], unsigned int k, slist_cmp_fn_t cmp)
+{
+    if (NULL == lists || NULL == cmp || 0 == k)
+    {
+        return false;
+    }
+
+    unsigned int total = 0;
+    for (unsigned int i = 0; i < k; i++)
+    {
+        if ((NULL == lists[i]) ||
+            (lists[i]->b_is_static != lists[0]->b_is_static) ||
+            (lists[i]->size > (UINT_MAX - total)))
+        {
+            return false;
+        }
+        total += lists[i]->size;
+    }
+
+    slist_merge_entry_t stack_heap[SLIST_MERGE_STACK];
+    slist_merge_entry_t *p_heap = stack_heap;
+    if (k > SLIST_MERGE_STACK)
+    {
+        p_heap = malloc(k * sizeof(slist_merge_entry_t));
+        if (NULL == p_heap)
+        {
+            /* Memory allocation failed. */
+            return false;
+        }
+    }
+
+    /* Nodes are relinked, so file-backed lists need regular nodes first. */
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < k; i++)
+    {
+        if (!slist_materialize(lists[i]))
+        {
+            if (p_heap != stack_heap)
+            {
+                free(p_heap);
+            }
+            return false;
+        }
+
+        if (NULL != lists[i]->p_head)
+        {
+            p_heap[count].p_node = lists[i]->p_head;
+            p_heap[count].list = i;
+            count++;
+        }
+    }
+
+    for (unsigned int i = count / 2U; i > 0U; i--)
+    {
+        slist_merge_sift_down(p_heap, count, i - 1U, cmp);
+    }
+
+    /* Repeatedly move the smallest head to the tail of the result. */
+    slist_node_t *p_head = NULL;
+    slist_node_t *p_tail = NULL;
+    while (count > 0)
+    {
+        slist_node_t *p_node = p_heap[0].p_node;
+
+        if (NULL == p_tail)
+        {
+            p_head = p_node;
+        }
+        else
+        {
+            p_tail->p_next = p_node;
+        }
+        p_tail = p_node;
+
+        if (NULL != p_node->p_next)
+        {
+            p_heap[0].p_node = p_node->p_next;
+        }
+        else
+        {
+            /* This list is exhausted. */
+            count--;
+            p_heap[0] = p_heap[count];
+        }
+        slist_merge_sift_down(p_heap, count, 0, cmp);
+    }
+
+    if (p_heap != stack_heap)
+    {
+        free(p_heap);
+    }
+
+    for (unsigned int i = 1; i < k; i++)
+    {
+        lists[i]->p_head = NULL;
+        lists[i]->p_tail = NULL;
+        lists[i]->size = 0;
+    }
+    lists[0]->p_head = p_head;
+    lists[0]->p_tail = p_tail;
+    lists[0]->size = total;
+
+    return true;
+} /* End of slist_merge_k() */
+
+/*!
+ * @brief Sorts the list with a merge sort.
+ * @param[in,out] p_list Pointer to the singly linked list.
+ * @param[in] cmp Comparison function.
+ * @return true If the list was sorted.
+ * @return false If p_list or cmp is NULL, or if memory allocation fails while
+ * copying a file-backed list into regular nodes.
+ * @note Time complexity: O(n log n), where n is the number of nodes.
+ * @note Nodes are relinked, not copied, and no memory is allocated. Sorted runs
+ * of 1, 2, 4, ... nodes are kept in SLIST_SORT_BINS bins and merged like a
+ * binary counter, so the sort is iterative and stable.
+ */
+bool slist_sort(slist_t *p_list, slist_cmp_fn_t cmp)
+{
+    if (NULL == p_list || NULL == cmp)
+    {
+        return false;
+    }
+
+    if (!slist_materialize(p_list))
+    {
+        return false;
+    }
+
+    if (p_list->size < 2U)
+    {
+        return true;
+    }
+
+    slist_node_t *bins[SLIST_SORT_BINS] = { NULL };
+    unsigned int used = 0;
+
+    while (NULL != p_list->p_head)
+    {
+        /* Detach the head as a run of one node. */
+        slist_node_t *p_run = p_list->p_head;
+        p_list->p_head = p_run->p_next;
+        p_run->p_next = NULL;
+
+        /* Carry: bin i holds a run of 2^i nodes, or nothing. */
+        unsigned int i = 0;
+        while ((i < used) && (NULL != bins[i]))
+        {
+            p_run = slist_merge_two(bins[i], p_run, cmp);
+            bins[i] = NULL;
+            i++;
+        }
+        bins[i] = p_run;
+        if (i == used)
+        {
+            used++;
+        }
+    }
+
+    /* Older (earlier) runs go first to keep the sort stable. */
+    slist_node_t *p_head = NULL;
+    for (unsigned int i = 0; i < used; i++)
+    {
+        if (NULL != bins[i])
+        {
+            p_head = slist_merge_two(bins[i], p_head, cmp);
+        }
+    }
+
+    slist_node_t *p_tail = p_head;
+    while (NULL != p_tail->p_next)
+    {
+        p_tail = p_tail->p_next;
+    }
+
+    p_list->p_head = p_head;
+    p_list->p_tail = p_tail;
+
+    return true;
+} /* End of slist_sort() */
+
+/*!
+ * @brief Sorts the list in ascending order with an LSD radix sort.
+ * @param[in,out] p_list Pointer to the singly linked list.
+ * @return true If the list was sorted.
+ * @return false If p_list is NULL, or if memory allocation fails while copying
+ * a file-backed list into regular nodes.
+ * @note Time complexity: O(n * 4), where n is the number of nodes.
+ * @note Each pass distributes the nodes by one byte of their data into
+ * SLIST_RADIX_BUCKETS bucket lists, appending at the bucket tails, and then
+ * concatenates the buckets in O(1) each. The sign bit is flipped so negative
+ * values order first. Passes over a byte that is the same in every node are
+ * skipped. Nodes are relinked, not copied, no memory is allocated, and the
+ * sort is stable.
+ */
+bool slist_radix_sort(slist_t *p_list)
+{
+    if (NULL == p_list)
+    {
+        return false;
+    }
+
+    if (!slist_materialize(p_list))
+    {
+        return false;
+    }
+
+    if (p_list->size < 2U)
+    {
+        return true;
+    }
+
+    /* Bits that differ between any two keys. */
+    uint32_t key_and = UINT32_MAX;
+    uint32_t key_or = 0;
+    for (const slist_node_t *p_node = p_list->p_head; NULL != p_node;
+         p_node = p_node->p_next)
+    {
+        uint32_t key = (uint32_t)p_node->data ^ 0x80000000U;
+        key_and &= key;
+        key_or |= key;
+    }
+    uint32_t diff = key_and ^ key_or;
+
+    slist_node_t *heads[SLIST_RADIX_BUCKETS];
+    slist_node_t *tails[SLIST_RADIX_BUCKETS];
+
+    for (uint32_t shift = 0; shift < 32U; shift += SLIST_RADIX_BITS)
+    {
+        if (0 == ((diff >> shift) & (SLIST_RADIX_BUCKETS - 1U)))
+        {
+            /* Every node falls into the same bucket. */
+            continue;
+        }
+
+        for (uint32_t b = 0; b < SLIST_RADIX_BUCKETS; b++)
+        {
+            heads[b] = NULL;
+        }
+
+        /* Distribute, appending to keep equal keys in order. */
+        for (slist_node_t *p_node = p_list->p_head; NULL != p_node;
+             p_node = p_node->p_next)
+        {
+            uint32_t key = (uint32_t)p_node->data ^ 0x80000000U;
+            uint32_t b = (key >> shift) & (SLIST_RADIX_BUCKETS - 1U);
+
+            if (NULL == heads[b])
+            {
+                heads[b] = p_node;
+            }
+            else
+            {
+                tails[b]->p_next = p_node;
+            }
+            tails[b] = p_node;
+        }
+
+        /* Concatenate the non-empty buckets. */
+        slist_node_t *p_tail = NULL;
+        for (uint32_t b = 0; b < SLIST_RADIX_BUCKETS; b++)
+        {
+            if (NULL == heads[b])
+            {
+                continue;
+            }
+
+            if (NULL == p_tail)
+            {
+                p_list->p_head = heads[b];
+            }
+            else
+            {
+                p_tail->p_next = heads[b];
+            }
+            p_tail = tails[b];
+        }
+        p_tail->p_next = NULL;
+        p_list->p_tail = p_tail;
+    }
+
+    return true;
+} /* End of slist_radix_sort() */
+
 /*!
  * @brief Displays all nodes in the list.
  * @param[in] p_list Pointer to the singly linked list.
@@ -317,6 +843,14 @@ void slist_display(slist_t *p_list)
         return;
     }  
 
+    if (NULL != p_list->p_mapped)
+    {
+        for (unsigned int i = 0; i < p_list->size; i++)
+        {
+            printf("%d -> ", p_list->p_mapped[i]);
+        }
+    }
+
     slist_node_t *p_curr = p_list->p_head;
     while (p_curr)
     {
@@ -326,4 +860,628 @@ void slist_display(slist_t *p_list)
     printf("NULL\n");
 } /* End of slist_display() */
 
+/*!
+ * @brief Saves the list to a file in a flat, versioned, checksummed format.
+ * @param[in] p_list Pointer to the singly linked list.
+ * @param[in] p_path Path of the file to create or overwrite.
+ * @return true If the whole list was written.
+ * @return false If p_list or p_path is NULL, or if any file operation fails.
+ * @note Time complexity: O(n), where n is the number of nodes.
+ * @note The elements are gathered into a chunk buffer so the file is written
+ * with large write() calls instead of one call per node. The file can be
+ * loaded back with slist_load_mmap().
+ */
+bool slist_save(const slist_t *p_list, const char *p_path)
+{
+    if (NULL == p_list || NULL == p_path)
+    {
+        return false;
+    }
+
+    int fd = open(p_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    slist_file_header_t header = { 0 };
+    header.magic = SLIST_FILE_MAGIC;
+    header.version = SLIST_FILE_VERSION;
+    header.elem_size = sizeof(int);
+    header.count = p_list->size;
+
+    /* Reserve room for the header; it is rewritten once the checksum is
+     * known. */
+    bool b_ok = slist_write_all(fd, &header, sizeof(header));
+
+    if (b_ok && (NULL != p_list->p_mapped))
+    {
+        /* File-backed list: the elements are already contiguous. */
+        header.checksum = slist_checksum(0, p_list->p_mapped, p_list->size);
+        b_ok = slist_write_all(fd, p_list->p_mapped,
+                               (size_t)p_list->size * sizeof(int));
+    }
+    else if (b_ok)
+    {
+        int *p_chunk = malloc(SLIST_SAVE_CHUNK * sizeof(int));
+        const slist_node_t *p_curr = p_list->p_head;
+
+        b_ok = (NULL != p_chunk);
+        while (b_ok && (NULL != p_curr))
+        {
+            size_t count = 0;
+
+            /* Gather a chunk of elements. */
+            while ((NULL != p_curr) && (count < SLIST_SAVE_CHUNK))
+            {
+                p_chunk[count++] = p_curr->data;
+                p_curr = p_curr->p_next;
+            }
+            header.checksum = slist_checksum(header.checksum, p_chunk, count);
+
+            b_ok = slist_write_all(fd, p_chunk, count * sizeof(int));
+        }
+        free(p_chunk);
+    }
+
+    if (b_ok)
+    {
+        b_ok = (sizeof(header) == pwrite(fd, &header, sizeof(header), 0));
+    }
+
+    if (0 != close(fd))
+    {
+        b_ok = false;
+    }
+
+    return b_ok;
+} /* End of slist_save() */
+
+/*!
+ * @brief Loads a list saved by slist_save() by mapping the file into memory.
+ * @param[in] p_path Path of the file to load.
+ * @param[in] b_verify Whether to verify the checksum of the elements.
+ * @return Pointer to the loaded list, or NULL if p_path is NULL, the file
+ * cannot be mapped, its header, size or checksum is invalid, or memory
+ * allocation fails.
+ * @note Time complexity: O(1) without verification, O(n) with it.
+ * @note No node is allocated: the list reads its elements straight from the
+ * read-only mapping, and removing the head only advances a cursor. The first
+ * addition to the list copies the remaining elements into regular nodes and
+ * releases the mapping (copy-on-write).
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling slist_destroy().
+ */
+slist_t* slist_load_mmap(const char *p_path, bool b_verify)
+{
+    if (NULL == p_path)
+    {
+        return NULL;
+    }
+
+    int fd = open(p_path, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    struct stat st;
+    if ((0 != fstat(fd, &st)) ||
+        ((size_t)st.st_size < sizeof(slist_file_header_t)))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    size_t map_len = (size_t)st.st_size;
+    void *p_map = mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == p_map)
+    {
+        return NULL;
+    }
+
+    /* Validate the header against the file. */
+    const slist_file_header_t *p_header = p_map;
+    const int *p_data = (const int *)(p_header + 1);
+    bool b_valid = (SLIST_FILE_MAGIC == p_header->magic) &&
+                   (SLIST_FILE_VERSION == p_header->version) &&
+                   (sizeof(int) == p_header->elem_size) &&
+                   (p_header->count <= UINT_MAX) &&
+                   ((map_len - sizeof(*p_header)) ==
+                    (p_header->count * sizeof(int)));
+
+    if (b_valid && b_verify)
+    {
+        b_valid = (p_header->checksum ==
+                   slist_checksum(0, p_data, (size_t)p_header->count));
+    }
+
+    slist_t *p_list = b_valid ? slist_create() : NULL;
+    if (NULL == p_list)
+    {
+        munmap(p_map, map_len);
+        return NULL;
+    }
+
+    p_list->size = (unsigned int)p_header->count;
+    if (0 == p_list->size)
+    {
+        munmap(p_map, map_len);
+        return p_list;
+    }
+
+    /* The data is read sequentially from head to tail. */
+    (void)posix_madvise(p_map, map_len, POSIX_MADV_SEQUENTIAL);
+
+    p_list->p_mapped = p_data;
+    p_list->p_map = p_map;
+    p_list->map_len = map_len;
+
+    return p_list;
+} /* End of slist_load_mmap() */
+
+/*!
+ * @brief Formats all nodes of the list into a caller-provided buffer.
+ * @param[in] p_list Pointer to the singly linked list.
+ * @param[in] format Output format.
+ * @param[out] p_buf Buffer receiving the output. May be NULL if buf_size is 0.
+ * @param[in] buf_size Capacity of p_buf in bytes.
+ * @param[out] p_total Optional; receives the number of bytes the complete dump
+ * requires. May be NULL.
+ * @return Number of bytes stored in p_buf. If the dump does not fit, the output
+ * ends after the last whole element that fits. Returns 0 if p_list is NULL.
+ * @note Time complexity: O(n), where n is the number of nodes.
+ * @note No terminating NUL character is written. Calling with a NULL buffer
+ * and a size of 0 yields the size to allocate in *p_total.
+ */
+size_t slist_dump(const slist_t *p_list, slist_dump_format_t format,
+                  char *p_buf, size_t buf_size, size_t *p_total)
+{
+    if (NULL == p_list)
+    {
+        return 0;
+    }
+
+    slist_dump_ctx_t ctx = { 0 };
+    ctx.p_buf = p_buf;
+    ctx.size = (NULL != p_buf) ? buf_size : 0;
+    ctx.fd = -1;
+
+    slist_dump_all(p_list, format, &ctx);
+
+    if (NULL != p_total)
+    {
+        *p_total = ctx.total;
+    }
+
+    return ctx.len;
+} /* End of slist_dump() */
+
+/*!
+ * @brief Formats all nodes of the list to a file descriptor.
+ * @param[in] p_list Pointer to the singly linked list.
+ * @param[in] format Output format.
+ * @param[in] fd File descriptor to write to.
+ * @return true If the whole dump was written.
+ * @return false If p_list is NULL, or if memory allocation or a write fails.
+ * @note Time complexity: O(n), where n is the number of nodes.
+ * @note Unlike slist_display(), elements are formatted with a table-driven
+ * integer conversion into a 64 KiB chunk that is written with one write() call
+ * when full, without going through stdio. Do not interleave with buffered
+ * stdio output on the same fd without flushing it first.
+ */
+bool slist_dump_fd(const slist_t *p_list, slist_dump_format_t format, int fd)
+{
+    if (NULL == p_list)
+    {
+        return false;
+    }
+
+    slist_dump_ctx_t ctx = { 0 };
+    ctx.p_buf = malloc(SLIST_DUMP_CHUNK);
+    ctx.size = SLIST_DUMP_CHUNK;
+    ctx.fd = fd;
+    if (NULL == ctx.p_buf)
+    {
+        /* Memory allocation failed. */
+        return false;
+    }
+
+    slist_dump_all(p_list, format, &ctx);
+    slist_dump_flush(&ctx);
+    free(ctx.p_buf);
+
+    return !ctx.b_error;
+} /* End of slist_dump_fd() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Converts a file-backed list into regular nodes (copy-on-write).
+ * @param[in,out] p_list Pointer to the singly linked list.
+ * @return true If the list holds regular nodes only on return.
+ * @return false If memory allocation fails; the list is left unchanged.
+ * @note Time complexity: O(n) for a file-backed list, O(1) otherwise.
+ */
+static bool slist_materialize(slist_t *p_list)
+{
+    if (NULL == p_list->p_mapped)
+    {
+        return true;
+    }
+
+    slist_node_t *p_head = NULL;
+    slist_node_t *p_tail = NULL;
+
+    for (unsigned int i = 0; i < p_list->size; i++)
+    {
+        slist_node_t *p_new = slist_node_alloc(p_list);
+        if (NULL == p_new)
+        {
+            /* Memory allocation failed: undo the partial copy. */
+            while (NULL != p_head)
+            {
+                slist_node_t *p_remove = p_head;
+                p_head = p_head->p_next;
+                slist_node_free(p_list, p_remove);
+            }
+            return false;
+        }
+        p_new->data = p_list->p_mapped[i];
+        p_new->p_next = NULL;
+
+        if (NULL == p_head)
+        {
+            p_head = p_new;
+        }
+        else
+        {
+            p_tail->p_next = p_new;
+        }
+        p_tail = p_new;
+    }
+
+    slist_unmap(p_list);
+    p_list->p_head = p_head;
+    p_list->p_tail = p_tail;
+
+    return true;
+} /* End of slist_materialize() */
+
+/*!
+ * @brief Releases the file mapping of a list, if any.
+ * @param[in,out] p_list Pointer to the singly linked list.
+ * @note The size is left untouched; callers update it as needed.
+ */
+static void slist_unmap(slist_t *p_list)
+{
+    if (NULL != p_list->p_map)
+    {
+        munmap(p_list->p_map, p_list->map_len);
+    }
+
+    p_list->p_mapped = NULL;
+    p_list->p_map = NULL;
+    p_list->map_len = 0;
+} /* End of slist_unmap() */
+
+/*!
+ * @brief Updates a Fletcher-style checksum with a run of elements.
+ * @param[in] sum Checksum of the preceding elements (0 to start).
+ * @param[in] p_data Elements to add.
+ * @param[in] count Number of elements.
+ * @return Updated checksum.
+ * @note Two running 32-bit sums are packed into the 64-bit result, so the
+ * checksum is sensitive to element order and can be computed chunk by chunk.
+ */
+static uint64_t slist_checksum(uint64_t sum, const int *p_data, size_t count)
+{
+    uint32_t sum1 = (uint32_t)sum;
+    uint32_t sum2 = (uint32_t)(sum >> 32);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        sum1 += (uint32_t)p_data[i];
+        sum2 += sum1;
+    }
+
+    return ((uint64_t)sum2 << 32) | sum1;
+} /* End of slist_checksum() */
+
+/*!
+ * @brief Writes a whole block of bytes to a file descriptor.
+ * @param[in] fd File descriptor to write to.
+ * @param[in] p_data Bytes to write.
+ * @param[in] bytes Number of bytes.
+ * @return true If all bytes were written.
+ * @return false If write() failed or wrote nothing.
+ * @note Normally a single system call; short writes (e.g., to a pipe) and
+ * EINTR are retried from the first byte not written.
+ */
+static bool slist_write_all(int fd, const void *p_data, size_t bytes)
+{
+    const char *p_bytes = p_data;
+
+    while (bytes > 0)
+    {
+        ssize_t n = write(fd, p_bytes, bytes);
+        if ((n < 0) && (EINTR == errno))
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        p_bytes += n;
+        bytes -= (size_t)n;
+    }
+
+    return true;
+} /* End of slist_write_all() */
+
+/*!
+ * @brief Emits every element of the list in the requested format.
+ * @param[in] p_list Pointer to the singly linked list.
+ * @param[in] format Output format.
+ * @param[in,out] p_ctx Output state.
+ */
+static void slist_dump_all(const slist_t *p_list, slist_dump_format_t format,
+                           slist_dump_ctx_t *p_ctx)
+{
+    const slist_node_t *p_curr = p_list->p_head;
+    const int *p_mapped = p_list->p_mapped;
+    unsigned int mapped_count = (NULL != p_mapped) ? p_list->size : 0;
+    char token[SLIST_INT_CHARS + 4];
+
+    if (SLIST_DUMP_BINARY == format)
+    {
+        if ((p_ctx->fd >= 0) && (mapped_count > 0))
+        {
+            /* A file-backed list is already contiguous, and nothing is staged
+             * yet: write it straight from the mapping. */
+            size_t bytes = mapped_count * sizeof(int);
+
+            p_ctx->total += bytes;
+            p_ctx->b_error = !slist_write_all(p_ctx->fd, p_mapped, bytes);
+        }
+        else
+        {
+            /* Element by element, so truncation keeps every int that fits. */
+            for (unsigned int i = 0; i < mapped_count; i++)
+            {
+                slist_dump_emit(p_ctx, &p_mapped[i], sizeof(int));
+            }
+        }
+        for (; NULL != p_curr; p_curr = p_curr->p_next)
+        {
+            slist_dump_emit(p_ctx, &p_curr->data, sizeof(int));
+        }
+        return;
+    }
+
+    for (unsigned int i = 0; (i < mapped_count) || (NULL != p_curr); i++)
+    {
+        int data;
+        if (i < mapped_count)
+        {
+            data = p_mapped[i];
+        }
+        else
+        {
+            data = p_curr->data;
+            p_curr = p_curr->p_next;
+        }
+
+        size_t len = 0;
+        if ((SLIST_DUMP_CSV == format) && (i > 0))
+        {
+            token[len++] = ',';
+        }
+        len += slist_format_int(data, &token[len]);
+        if (SLIST_DUMP_TEXT == format)
+        {
+            memcpy(&token[len], " -> ", 4);
+            len += 4;
+        }
+        slist_dump_emit(p_ctx, token, len);
+    }
+
+    if (SLIST_DUMP_TEXT == format)
+    {
+        slist_dump_emit(p_ctx, "NULL\n", 5);
+    }
+    else
+    {
+        slist_dump_emit(p_ctx, "\n", 1);
+    }
+} /* End of slist_dump_all() */
+
+/*!
+ * @brief Appends a token to the dump output.
+ * @param[in,out] p_ctx Output state.
+ * @param[in] p_src Bytes to append.
+ * @param[in] len Number of bytes, at most SLIST_INT_CHARS + 4, so that in fd
+ * mode the token always fits once the chunk has been flushed.
+ */
+static void slist_dump_emit(slist_dump_ctx_t *p_ctx, const void *p_src,
+                            size_t len)
+{
+    bool b_stored_all = (p_ctx->len == p_ctx->total);
+
+    p_ctx->total += len;
+
+    if (p_ctx->fd < 0)
+    {
+        /* Once a token has been dropped, drop the rest too. */
+        if (b_stored_all && (len <= (p_ctx->size - p_ctx->len)))
+        {
+            memcpy(&p_ctx->p_buf[p_ctx->len], p_src, len);
+            p_ctx->len += len;
+        }
+        return;
+    }
+
+    if (len > (p_ctx->size - p_ctx->len))
+    {
+        slist_dump_flush(p_ctx);
+    }
+
+    memcpy(&p_ctx->p_buf[p_ctx->len], p_src, len);
+    p_ctx->len += len;
+} /* End of slist_dump_emit() */
+
+/*!
+ * @brief Writes out the staged chunk and empties it.
+ * @param[in,out] p_ctx Output state with a valid fd.
+ * @note Short writes and EINTR are retried; any other failure sets b_error,
+ * after which nothing more is written.
+ */
+static void slist_dump_flush(slist_dump_ctx_t *p_ctx)
+{
+    if (!p_ctx->b_error)
+    {
+        p_ctx->b_error = !slist_write_all(p_ctx->fd, p_ctx->p_buf, p_ctx->len);
+    }
+
+    p_ctx->len = 0;
+} /* End of slist_dump_flush() */
+
+/*!
+ * @brief Converts an int to decimal ASCII.
+ * @param[in] value Value to convert.
+ * @param[out] p_out Buffer of at least SLIST_INT_CHARS bytes. No NUL is added.
+ * @return Number of characters written.
+ * @note Two digits are produced per division using g_digit_pairs, which is
+ * several times faster than printf("%d").
+ */
+static size_t slist_format_int(int value, char *p_out)
+{
+    char tmp[SLIST_INT_CHARS];
+    char *p_end = &tmp[SLIST_INT_CHARS];
+    char *p_pos = p_end;
+    unsigned int u = (value < 0) ? (0U - (unsigned int)value) :
+                                   (unsigned int)value;
+
+    while (u >= 100U)
+    {
+        unsigned int idx = (u % 100U) * 2U;
+        u /= 100U;
+        *--p_pos = g_digit_pairs[idx + 1U];
+        *--p_pos = g_digit_pairs[idx];
+    }
+
+    if (u >= 10U)
+    {
+        *--p_pos = g_digit_pairs[(u * 2U) + 1U];
+        *--p_pos = g_digit_pairs[u * 2U];
+    }
+    else
+    {
+        *--p_pos = (char)('0' + u);
+    }
+
+    if (value < 0)
+    {
+        *--p_pos = '-';
+    }
+
+    size_t len = (size_t)(p_end - p_pos);
+    memcpy(p_out, p_pos, len);
+
+    return len;
+} /* End of slist_format_int() */
+
+/*!
+ * @brief Orders two heap entries of slist_merge_k().
+ * @param[in] p_a First entry.
+ * @param[in] p_b Second entry.
+ * @param[in] cmp Comparison function of the merge.
+ * @return true If p_a must be merged before p_b.
+ * @return false Otherwise.
+ */
+static bool slist_merge_less(const slist_merge_entry_t *p_a,
+                             const slist_merge_entry_t *p_b,
+                             slist_cmp_fn_t cmp)
+{
+    int order = cmp(p_a->p_node->data, p_b->p_node->data);
+
+    return (order < 0) || ((0 == order) && (p_a->list < p_b->list));
+} /* End of slist_merge_less() */
+
+/*!
+ * @brief Restores the heap order below an entry of slist_merge_k().
+ * @param[in,out] p_heap Heap of list heads.
+ * @param[in] count Number of entries in the heap.
+ * @param[in] idx Index of the entry that may be out of order.
+ * @param[in] cmp Comparison function of the merge.
+ * @note Time complexity: O(log k), where k is count.
+ */
+static void slist_merge_sift_down(slist_merge_entry_t *p_heap,
+                                  unsigned int count, unsigned int idx,
+                                  slist_cmp_fn_t cmp)
+{
+    slist_merge_entry_t entry = p_heap[idx];
+
+    for (;;)
+    {
+        unsigned int child = (2U * idx) + 1U;
+        if (child >= count)
+        {
+            break;
+        }
+
+        if (((child + 1U) < count) &&
+            slist_merge_less(&p_heap[child + 1U], &p_heap[child], cmp))
+        {
+            child++;
+        }
+
+        if (!slist_merge_less(&p_heap[child], &entry, cmp))
+        {
+            break;
+        }
+
+        p_heap[idx] = p_heap[child];
+        idx = child;
+    }
+
+    p_heap[idx] = entry;
+} /* End of slist_merge_sift_down() */
+
+/*!
+ * @brief Merges two sorted chains of nodes.
+ * @param[in] p_a First chain, or NULL. Wins ties.
+ * @param[in] p_b Second chain, or NULL.
+ * @param[in] cmp Comparison function.
+ * @return Head of the merged chain, which ends with a NULL p_next.
+ * @note Time complexity: O(a + b), where a and b are the chain lengths.
+ */
+static slist_node_t* slist_merge_two(slist_node_t *p_a, slist_node_t *p_b,
+                                     slist_cmp_fn_t cmp)
+{
+    slist_node_t head;
+    slist_node_t *p_tail = &head;
+
+    while ((NULL != p_a) && (NULL != p_b))
+    {
+        if (cmp(p_b->data, p_a->data) < 0)
+        {
+            p_tail->p_next = p_b;
+            p_b = p_b->p_next;
+        }
+        else
+        {
+            p_tail->p_next = p_a;
+            p_a = p_a->p_next;
+        }
+        p_tail = p_tail->p_next;
+    }
+
+    p_tail->p_next = (NULL != p_a) ? p_a : p_b;
+
+    return head.p_next;
+} /* End of slist_merge_two() */
+
 /*** End of file: slist.c */ 
\ No newline at end of file
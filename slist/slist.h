@@ -16,13 +16,69 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+/* Bytes reserved by slist_storage_t and slist_node_storage_t; both are checked
+ * against the private definitions at build time. */
+#define SLIST_STORAGE_SIZE      (64U)
+#define SLIST_NODE_STORAGE_SIZE (2U * sizeof(void *))
 
 /* Opaque type declarations --------------------------------------------------*/
 typedef struct slist_t slist_t;
 
+/* Public data types ---------------------------------------------------------*/
+
+/*!
+ * @brief Caller-provided memory for a list control structure.
+ * @note Only its size and alignment are public; see slist_init().
+ */
+typedef union
+{
+    void *p_align;
+    uint64_t align;
+    unsigned char bytes[SLIST_STORAGE_SIZE];
+} slist_storage_t;
+
+/*!
+ * @brief Caller-provided memory for one list node.
+ * @note Only its size and alignment are public; see slist_init().
+ */
+typedef union
+{
+    void *p_align;
+    unsigned char bytes[SLIST_NODE_STORAGE_SIZE];
+} slist_node_storage_t;
+
+/*!
+ * @brief Output formats of slist_dump() and slist_dump_fd().
+ */
+typedef enum
+{
+    SLIST_DUMP_TEXT,    /* Same as slist_display(): "1 -> 2 -> NULL\n". */
+    SLIST_DUMP_CSV,     /* One line of comma-separated values: "1,2\n". */
+    SLIST_DUMP_BINARY   /* Raw int values in host byte order. */
+} slist_dump_format_t;
+
+/*!
+ * @brief Comparison function of sorted operations.
+ * @param[in] a First value.
+ * @param[in] b Second value.
+ * @return Negative if a orders before b, 0 if they are equivalent, positive
+ * otherwise.
+ */
+typedef int (*slist_cmp_fn_t)(int a, int b);
+
 /* Public APIs ---------------------------------------------------------------*/
 
 slist_t* slist_create(void);                              
+slist_t* slist_init(slist_storage_t *p_storage, slist_node_storage_t *p_nodes,
+                    unsigned int node_count);
 bool slist_destroy(slist_t *p_list);
 bool slist_add_to_head(slist_t *p_list, int data);            
 bool slist_add_to_tail(slist_t *p_list, int data);
@@ -31,7 +87,24 @@ bool slist_remove_head(slist_t *p_list, int *p_data);
 bool slist_is_empty(const slist_t *p_list);
 unsigned int slist_size(const slist_t *p_list);
 void slist_clear(slist_t *p_list);
+bool slist_insert_sorted(slist_t *p_list, int data, slist_cmp_fn_t cmp);
+bool slist_merge_k(slist_t *lists[], unsigned int k, slist_cmp_fn_t cmp);
+bool slist_sort(slist_t *p_list, slist_cmp_fn_t cmp);
+bool slist_radix_sort(slist_t *p_list);
 void slist_display(slist_t *p_list);
+bool slist_save(const slist_t *p_list, const char *p_path);
+slist_t* slist_load_mmap(const char *p_path, bool b_verify);
+size_t slist_dump(const slist_t *p_list, slist_dump_format_t format,
+                  char *p_buf, size_t buf_size, size_t *p_total);
+bool slist_dump_fd(const slist_t *p_list, slist_dump_format_t format, int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SLIST_INLINE
+#include "slist_inline.h"   /* Opt-in unchecked fast paths. */
+#endif
 
 #endif /* SLIST_H */
 
@@ -0,0 +1,406 @@
+/*******************************************************************************
+ *
+ * @file    slist.hpp
+ * @brief   Header-only C++ template of the singly linked list.
+ * @details dsa::slist<T, Alloc> mirrors the slist.h API (add_to_head(),
+ *          add_to_tail(), peek_head(), remove_head(), ...) for an arbitrary
+ *          element type. Since everything is visible to the compiler, calls
+ *          can be inlined, elements are stored in the node itself instead of
+ *          being converted to int, and move-only types are supported through
+ *          the emplace and move overloads. Forward iterators allow range-for
+ *          loops and STL algorithms.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Nodes are obtained from Alloc rebound to the node type, so pool or
+ *          arena allocators can be plugged in.
+ *
+ ******************************************************************************/
+
+#ifndef SLIST_HPP
+#define SLIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+/*!
+ * @brief Singly linked list with O(1) insertion at both ends.
+ * @tparam T Element type. Need not be copyable.
+ * @tparam Alloc Allocator of T; it is rebound to allocate whole nodes.
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class slist
+{
+private:
+    struct node
+    {
+        template <typename... Args>
+        explicit node(Args &&...args)
+            : data(std::forward<Args>(args)...), p_next(nullptr)
+        {
+        }
+
+        T data;
+        node *p_next;
+    };
+
+    using node_alloc_t =
+        typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+    using node_traits = std::allocator_traits<node_alloc_t>;
+
+    template <bool b_const>
+    class basic_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<b_const, const T*, T*>;
+        using reference = std::conditional_t<b_const, const T&, T&>;
+
+        basic_iterator() noexcept : m_p_node(nullptr) {}
+
+        /* Allows iterator -> const_iterator conversion. */
+        template <bool b_other, typename = std::enable_if_t<b_const && !b_other>>
+        basic_iterator(const basic_iterator<b_other> &other) noexcept
+            : m_p_node(other.m_p_node)
+        {
+        }
+
+        reference operator*() const noexcept { return m_p_node->data; }
+        pointer operator->() const noexcept { return &m_p_node->data; }
+
+        basic_iterator& operator++() noexcept
+        {
+            m_p_node = m_p_node->p_next;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            basic_iterator prev = *this;
+            m_p_node = m_p_node->p_next;
+            return prev;
+        }
+
+        friend bool operator==(const basic_iterator &lhs,
+                               const basic_iterator &rhs) noexcept
+        {
+            return lhs.m_p_node == rhs.m_p_node;
+        }
+
+        friend bool operator!=(const basic_iterator &lhs,
+                               const basic_iterator &rhs) noexcept
+        {
+            return lhs.m_p_node != rhs.m_p_node;
+        }
+
+    private:
+        friend class slist;
+        template <bool> friend class basic_iterator;
+
+        explicit basic_iterator(node *p_node) noexcept : m_p_node(p_node) {}
+
+        node *m_p_node;
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    slist() noexcept(noexcept(node_alloc_t())) : m_alloc() {}
+
+    explicit slist(const Alloc &alloc) noexcept : m_alloc(alloc) {}
+
+    slist(const slist &other)
+        : m_alloc(node_traits::select_on_container_copy_construction(
+              other.m_alloc))
+    {
+        append_copy(other);
+    }
+
+    slist(slist &&other) noexcept : m_alloc(std::move(other.m_alloc))
+    {
+        steal(other);
+    }
+
+    ~slist()
+    {
+        clear();
+    }
+
+    slist& operator=(const slist &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            if constexpr (
+                node_traits::propagate_on_container_copy_assignment::value)
+            {
+                m_alloc = other.m_alloc;
+            }
+            append_copy(other);
+        }
+        return *this;
+    }
+
+    slist& operator=(slist &&other) noexcept(
+        node_traits::propagate_on_container_move_assignment::value ||
+        node_traits::is_always_equal::value)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+        if constexpr (
+            node_traits::propagate_on_container_move_assignment::value)
+        {
+            m_alloc = std::move(other.m_alloc);
+            steal(other);
+        }
+        else
+        {
+            if (m_alloc == other.m_alloc)
+            {
+                steal(other);
+            }
+            else
+            {
+                /* Nodes cannot change allocators: move element-wise. */
+                for (T &data : other)
+                {
+                    add_to_tail(std::move(data));
+                }
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    /*!
+     * @brief Inserts an element at the head of the list.
+     * @param[in] data Element to copy or move into the list.
+     * @note Time complexity: O(1)
+     * @throw Whatever the allocator or T's constructor throws; the list is
+     * left unchanged.
+     */
+    void add_to_head(const T &data) { emplace_head(data); }
+    void add_to_head(T &&data) { emplace_head(std::move(data)); }
+
+    /*!
+     * @brief Inserts an element at the tail of the list.
+     * @param[in] data Element to copy or move into the list.
+     * @note Time complexity: O(1)
+     */
+    void add_to_tail(const T &data) { emplace_tail(data); }
+    void add_to_tail(T &&data) { emplace_tail(std::move(data)); }
+
+    /*!
+     * @brief Constructs an element in place at the head of the list.
+     * @param[in] args Arguments forwarded to T's constructor.
+     * @return Reference to the new element.
+     * @note Time complexity: O(1)
+     */
+    template <typename... Args>
+    T& emplace_head(Args &&...args)
+    {
+        node *p_new = create_node(std::forward<Args>(args)...);
+
+        p_new->p_next = m_p_head;
+        m_p_head = p_new;
+        if (nullptr == m_p_tail)
+        {
+            m_p_tail = p_new;
+        }
+        m_size++;
+
+        return p_new->data;
+    }
+
+    /*!
+     * @brief Constructs an element in place at the tail of the list.
+     * @param[in] args Arguments forwarded to T's constructor.
+     * @return Reference to the new element.
+     * @note Time complexity: O(1)
+     */
+    template <typename... Args>
+    T& emplace_tail(Args &&...args)
+    {
+        node *p_new = create_node(std::forward<Args>(args)...);
+
+        if (nullptr == m_p_tail)
+        {
+            m_p_head = p_new;
+        }
+        else
+        {
+            m_p_tail->p_next = p_new;
+        }
+        m_p_tail = p_new;
+        m_size++;
+
+        return p_new->data;
+    }
+
+    /*!
+     * @brief Retrieves a pointer to the element at the head of the list.
+     * @return Pointer to the head element, or nullptr if the list is empty.
+     * @note Time complexity: O(1)
+     * @note Unlike slist_peek_head(), no copy is made.
+     */
+    T* peek_head() noexcept
+    {
+        return (nullptr == m_p_head) ? nullptr : &m_p_head->data;
+    }
+
+    const T* peek_head() const noexcept
+    {
+        return (nullptr == m_p_head) ? nullptr : &m_p_head->data;
+    }
+
+    /*!
+     * @brief Removes the head element, moving it out.
+     * @param[out] data Receives the removed element.
+     * @return true If an element was removed.
+     * @return false If the list is empty.
+     * @note Time complexity: O(1)
+     */
+    bool remove_head(T &data)
+    {
+        if (nullptr == m_p_head)
+        {
+            return false;
+        }
+
+        data = std::move(m_p_head->data);
+        pop_head_node();
+
+        return true;
+    }
+
+    /*!
+     * @brief Removes and destroys the head element.
+     * @return true If an element was removed.
+     * @return false If the list is empty.
+     * @note Time complexity: O(1)
+     */
+    bool remove_head() noexcept
+    {
+        if (nullptr == m_p_head)
+        {
+            return false;
+        }
+
+        pop_head_node();
+
+        return true;
+    }
+
+    bool is_empty() const noexcept { return 0 == m_size; }
+    size_type size() const noexcept { return m_size; }
+
+    /*!
+     * @brief Removes and destroys all elements.
+     * @note Time complexity: O(n)
+     */
+    void clear() noexcept
+    {
+        while (nullptr != m_p_head)
+        {
+            pop_head_node();
+        }
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(m_alloc);
+    }
+
+    iterator begin() noexcept { return iterator(m_p_head); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator begin() const noexcept { return const_iterator(m_p_head); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    template <typename... Args>
+    node* create_node(Args &&...args)
+    {
+        node *p_new = node_traits::allocate(m_alloc, 1);
+
+        try
+        {
+            node_traits::construct(m_alloc, p_new,
+                                   std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(m_alloc, p_new, 1);
+            throw;
+        }
+
+        return p_new;
+    }
+
+    void pop_head_node() noexcept
+    {
+        node *p_remove = m_p_head;
+
+        m_p_head = p_remove->p_next;
+        if (nullptr == m_p_head)
+        {
+            m_p_tail = nullptr;
+        }
+        m_size--;
+
+        node_traits::destroy(m_alloc, p_remove);
+        node_traits::deallocate(m_alloc, p_remove, 1);
+    }
+
+    void append_copy(const slist &other)
+    {
+        try
+        {
+            for (const T &data : other)
+            {
+                add_to_tail(data);
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    void steal(slist &other) noexcept
+    {
+        m_p_head = std::exchange(other.m_p_head, nullptr);
+        m_p_tail = std::exchange(other.m_p_tail, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    node_alloc_t m_alloc;
+    node *m_p_head = nullptr;
+    node *m_p_tail = nullptr;   /* Enables O(1) tail insertion. */
+    size_type m_size = 0;
+};
+
+} /* namespace dsa */
+
+#endif /* SLIST_HPP */
+
+/*** End of file: slist.hpp ***/
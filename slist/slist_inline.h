@@ -0,0 +1,237 @@
+/*******************************************************************************
+ *
+ * @file    slist_inline.h
+ * @brief   Definition of slist_t and inlinable fast-path operations.
+ * @details The checked APIs in slist.h are compiled in slist.c, so each call
+ *          in a tight loop pays for a call across translation units plus NULL
+ *          checks the compiler cannot hoist. Defining SLIST_INLINE before
+ *          including slist.h (or passing -DSLIST_INLINE) also pulls in this
+ *          header, which exposes the structure definitions and the static
+ *          inline *_fast() variants below.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The *_fast() functions perform no argument checks: the caller
+ *          guarantees valid, non-NULL pointers. A file-backed list (see
+ *          slist_load_mmap()) is handed to the checked function, so both
+ *          kinds of call may be mixed on any list. Code that does not define
+ *          SLIST_INLINE still sees slist_t as an opaque type.
+ *
+ ******************************************************************************/
+
+#ifndef SLIST_INLINE_H
+#define SLIST_INLINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "slist.h"
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Structure representing a node in a singly linked list.
+ * @note Members must only be accessed by slist.c and the functions in this
+ * header.
+ */
+typedef struct slist_node_t
+{
+   int data;
+   struct slist_node_t *p_next;
+} slist_node_t;
+
+/*!
+ * @brief Structure representing a singly linked list.
+ * @note Members must only be accessed by slist.c and the functions in this
+ * header.
+ */
+struct slist_t
+{
+   slist_node_t *p_head;
+   slist_node_t *p_tail; /* Enables O(1) push_back(). */
+   unsigned int size;
+   const int *p_mapped;  /* Head of a file-backed list, or NULL. */
+   void *p_map;          /* Base of the file mapping, or NULL. */
+   size_t map_len;
+   slist_node_t *p_free; /* Unused caller-provided nodes, see slist_init(). */
+   bool b_is_static;     /* Nodes and list are caller-provided. */
+};
+
+/* Node allocation -----------------------------------------------------------*/
+
+/*!
+ * @brief Obtains an unused node for the list.
+ * @param[in,out] p_list Pointer to the singly linked list.
+ * @return Pointer to the node, or NULL if memory allocation fails or no
+ * caller-provided node is left.
+ * @note Time complexity: O(1)
+ */
+static inline slist_node_t* slist_node_alloc(slist_t *p_list)
+{
+    if (!p_list->b_is_static)
+    {
+        return malloc(sizeof(slist_node_t));
+    }
+
+    slist_node_t *p_node = p_list->p_free;
+    if (NULL != p_node)
+    {
+        p_list->p_free = p_node->p_next;
+    }
+
+    return p_node;
+} /* End of slist_node_alloc() */
+
+/*!
+ * @brief Returns a node obtained by slist_node_alloc().
+ * @param[in,out] p_list Pointer to the singly linked list.
+ * @param[in] p_node Node to release.
+ * @note Time complexity: O(1)
+ */
+static inline void slist_node_free(slist_t *p_list, slist_node_t *p_node)
+{
+    if (!p_list->b_is_static)
+    {
+        free(p_node);
+        return;
+    }
+
+    p_node->p_next = p_list->p_free;
+    p_list->p_free = p_node;
+} /* End of slist_node_free() */
+
+/* Inline fast-path APIs -----------------------------------------------------*/
+
+/*!
+ * @brief Unchecked slist_add_to_head().
+ * @param[in,out] p_list Pointer to the singly linked list. Must not be NULL.
+ * @param[in] data Data to add.
+ * @return true If the addition was successful.
+ * @return false If memory allocation fails, or if all nodes of a list set up
+ * by slist_init() are in use.
+ * @note Time complexity: O(1)
+ */
+static inline bool slist_add_to_head_fast(slist_t *p_list, int data)
+{
+    if (NULL != p_list->p_mapped)
+    {
+        return slist_add_to_head(p_list, data);
+    }
+
+    slist_node_t *p_new = slist_node_alloc(p_list);
+    if (NULL == p_new)
+    {
+        return false;
+    }
+    p_new->data = data;
+    p_new->p_next = p_list->p_head;
+
+    p_list->p_head = p_new;
+    if (NULL == p_list->p_tail)
+    {
+        p_list->p_tail = p_new;
+    }
+    p_list->size++;
+
+    return true;
+} /* End of slist_add_to_head_fast() */
+
+/*!
+ * @brief Unchecked slist_add_to_tail().
+ * @param[in,out] p_list Pointer to the singly linked list. Must not be NULL.
+ * @param[in] data Data to add.
+ * @return true If the addition was successful.
+ * @return false If memory allocation fails, or if all nodes of a list set up
+ * by slist_init() are in use.
+ * @note Time complexity: O(1)
+ */
+static inline bool slist_add_to_tail_fast(slist_t *p_list, int data)
+{
+    if (NULL != p_list->p_mapped)
+    {
+        return slist_add_to_tail(p_list, data);
+    }
+
+    slist_node_t *p_new = slist_node_alloc(p_list);
+    if (NULL == p_new)
+    {
+        return false;
+    }
+    p_new->data = data;
+    p_new->p_next = NULL;
+
+    if (NULL == p_list->p_tail)
+    {
+        p_list->p_head = p_new;
+    }
+    else
+    {
+        p_list->p_tail->p_next = p_new;
+    }
+    p_list->p_tail = p_new;
+    p_list->size++;
+
+    return true;
+} /* End of slist_add_to_tail_fast() */
+
+/*!
+ * @brief Unchecked slist_peek_head().
+ * @param[in] p_list Pointer to the singly linked list. Must not be NULL.
+ * @param[out] p_data Pointer to store the data at the head. Must not be NULL.
+ * @return true If the peek was successful.
+ * @return false If the list is empty.
+ * @note Time complexity: O(1)
+ */
+static inline bool slist_peek_head_fast(const slist_t *p_list, int *p_data)
+{
+    if (NULL != p_list->p_mapped)
+    {
+        return slist_peek_head(p_list, p_data);
+    }
+
+    if (NULL == p_list->p_head)
+    {
+        return false;
+    }
+
+    *p_data = p_list->p_head->data;
+
+    return true;
+} /* End of slist_peek_head_fast() */
+
+/*!
+ * @brief Unchecked slist_remove_head().
+ * @param[in,out] p_list Pointer to the singly linked list. Must not be NULL.
+ * @param[out] p_data Pointer to store the data at the head. Must not be NULL.
+ * @return true If the removal was successful.
+ * @return false If the list is empty.
+ * @note Time complexity: O(1)
+ */
+static inline bool slist_remove_head_fast(slist_t *p_list, int *p_data)
+{
+    if (NULL != p_list->p_mapped)
+    {
+        return slist_remove_head(p_list, p_data);
+    }
+
+    slist_node_t *p_remove = p_list->p_head;
+    if (NULL == p_remove)
+    {
+        return false;
+    }
+
+    *p_data = p_remove->data;
+
+    p_list->p_head = p_remove->p_next;
+    if (NULL == p_list->p_head)
+    {
+        p_list->p_tail = NULL;
+    }
+    p_list->size--;
+    slist_node_free(p_list, p_remove);
+
+    return true;
+} /* End of slist_remove_head_fast() */
+
+#endif /* SLIST_INLINE_H */
+
+/*** End of file: slist_inline.h ***/
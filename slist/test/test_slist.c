@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include "../../third_party/unity/src/unity.h"
 #include "../slist.h"
 
@@ -19,4 +20,199 @@ void test_slist_create_should_return_not_null(void)
     slist_t *p_list = slist_create();
     TEST_ASSERT_NOT_NULL(p_list);
     slist_destroy(p_list);
-}
\ No newline at end of file
+}
+
+/*!
+ * @brief Test case 2: a saved list loads back in the same order.
+ */
+void test_slist_load_mmap_should_restore_saved_list(void)
+{
+    slist_t *p_list = slist_create();
+    int data;
+
+    for (int i = -3; i < 5; i++)
+    {
+        slist_add_to_tail(p_list, i);
+    }
+    TEST_ASSERT_TRUE(slist_save(p_list, "test_slist.bin"));
+
+    slist_t *p_loaded = slist_load_mmap("test_slist.bin", true);
+    TEST_ASSERT_NOT_NULL(p_loaded);
+    TEST_ASSERT_EQUAL_UINT(8, slist_size(p_loaded));
+
+    for (int i = -3; i < 5; i++)
+    {
+        TEST_ASSERT_TRUE(slist_remove_head(p_loaded, &data));
+        TEST_ASSERT_EQUAL_INT(i, data);
+    }
+    TEST_ASSERT_TRUE(slist_is_empty(p_loaded));
+
+    slist_destroy(p_loaded);
+    slist_destroy(p_list);
+    remove("test_slist.bin");
+}
+
+/*!
+ * @brief Test case 3: adding to a loaded list copies it into regular nodes.
+ */
+void test_slist_load_mmap_should_copy_on_write(void)
+{
+    slist_t *p_list = slist_create();
+    int data;
+
+    slist_add_to_tail(p_list, 1);
+    slist_add_to_tail(p_list, 2);
+    TEST_ASSERT_TRUE(slist_save(p_list, "test_slist.bin"));
+
+    slist_t *p_loaded = slist_load_mmap("test_slist.bin", false);
+    TEST_ASSERT_TRUE(slist_add_to_head(p_loaded, 0));
+    TEST_ASSERT_TRUE(slist_add_to_tail(p_loaded, 3));
+    TEST_ASSERT_EQUAL_UINT(4, slist_size(p_loaded));
+
+    for (int i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_TRUE(slist_remove_head(p_loaded, &data));
+        TEST_ASSERT_EQUAL_INT(i, data);
+    }
+
+    slist_destroy(p_loaded);
+    slist_destroy(p_list);
+    remove("test_slist.bin");
+}
+
+/*!
+ * @brief Test case 4: a list in caller-provided memory recycles its nodes.
+ */
+void test_slist_init_should_use_only_provided_nodes(void)
+{
+    slist_storage_t storage;
+    slist_node_storage_t nodes[3];
+    int data;
+
+    slist_t *p_list = slist_init(&storage, nodes, 3);
+    TEST_ASSERT_NOT_NULL(p_list);
+
+    TEST_ASSERT_TRUE(slist_add_to_tail(p_list, 1));
+    TEST_ASSERT_TRUE(slist_add_to_tail(p_list, 2));
+    TEST_ASSERT_TRUE(slist_add_to_head(p_list, 0));
+    TEST_ASSERT_FALSE(slist_add_to_tail(p_list, 3));
+
+    TEST_ASSERT_TRUE(slist_remove_head(p_list, &data));
+    TEST_ASSERT_EQUAL_INT(0, data);
+    TEST_ASSERT_TRUE(slist_add_to_tail(p_list, 3));
+
+    for (int i = 1; i <= 3; i++)
+    {
+        TEST_ASSERT_TRUE(slist_remove_head(p_list, &data));
+        TEST_ASSERT_EQUAL_INT(i, data);
+    }
+
+    TEST_ASSERT_TRUE(slist_destroy(p_list));
+}
+
+static int cmp_int(int a, int b)
+{
+    return (a > b) - (a < b);
+}
+
+/*!
+ * @brief Test case 5: sorted insertion keeps the list ordered.
+ */
+void test_slist_insert_sorted_should_keep_order(void)
+{
+    slist_t *p_list = slist_create();
+    const int values[] = { 5, 1, 4, 1, 9, 2, 6 };
+    const int sorted[] = { 1, 1, 2, 4, 5, 6, 9 };
+    int data;
+
+    for (int i = 0; i < 7; i++)
+    {
+        TEST_ASSERT_TRUE(slist_insert_sorted(p_list, values[i], cmp_int));
+    }
+    TEST_ASSERT_TRUE(slist_add_to_tail(p_list, 10));
+
+    for (int i = 0; i < 7; i++)
+    {
+        TEST_ASSERT_TRUE(slist_remove_head(p_list, &data));
+        TEST_ASSERT_EQUAL_INT(sorted[i], data);
+    }
+    TEST_ASSERT_TRUE(slist_remove_head(p_list, &data));
+    TEST_ASSERT_EQUAL_INT(10, data);
+
+    slist_destroy(p_list);
+}
+
+/*!
+ * @brief Test case 6: k sorted lists merge into the first one.
+ */
+void test_slist_merge_k_should_merge_into_first_list(void)
+{
+    slist_t *lists[40];
+    int data;
+
+    /* More lists than SLIST_MERGE_STACK, some of them empty. */
+    for (int i = 0; i < 40; i++)
+    {
+        lists[i] = slist_create();
+        for (int v = i; (0 != i % 3) && (v < 400); v += 40)
+        {
+            slist_add_to_tail(lists[i], v);
+        }
+    }
+
+    TEST_ASSERT_TRUE(slist_merge_k(lists, 40, cmp_int));
+    TEST_ASSERT_EQUAL_UINT(260, slist_size(lists[0]));
+    TEST_ASSERT_TRUE(slist_is_empty(lists[1]));
+
+    int prev = -1;
+    for (int i = 0; i < 260; i++)
+    {
+        TEST_ASSERT_TRUE(slist_remove_head(lists[0], &data));
+        TEST_ASSERT_TRUE(data > prev);
+        prev = data;
+    }
+
+    /* The tail of the result is valid. */
+    TEST_ASSERT_TRUE(slist_add_to_tail(lists[0], 1));
+    TEST_ASSERT_TRUE(slist_peek_head(lists[0], &data));
+    TEST_ASSERT_EQUAL_INT(1, data);
+
+    for (int i = 0; i < 40; i++)
+    {
+        slist_destroy(lists[i]);
+    }
+}
+
+/*!
+ * @brief Test case 7: radix sort and merge sort order negative values first.
+ */
+void test_slist_sort_should_order_negative_values_first(void)
+{
+    const int values[] = { 7, -1, 0, 2147483647, -2147483647 - 1, 256, -256,
+                           7, 65536, -65536 };
+    const int sorted[] = { -2147483647 - 1, -65536, -256, -1, 0, 7, 7, 256,
+                           65536, 2147483647 };
+    slist_t *p_radix = slist_create();
+    slist_t *p_merge = slist_create();
+    int data;
+
+    for (int i = 0; i < 10; i++)
+    {
+        slist_add_to_tail(p_radix, values[i]);
+        slist_add_to_tail(p_merge, values[i]);
+    }
+
+    TEST_ASSERT_TRUE(slist_radix_sort(p_radix));
+    TEST_ASSERT_TRUE(slist_sort(p_merge, cmp_int));
+
+    for (int i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_TRUE(slist_remove_head(p_radix, &data));
+        TEST_ASSERT_EQUAL_INT(sorted[i], data);
+        TEST_ASSERT_TRUE(slist_remove_head(p_merge, &data));
+        TEST_ASSERT_EQUAL_INT(sorted[i], data);
+    }
+
+    slist_destroy(p_radix);
+    slist_destroy(p_merge);
+}
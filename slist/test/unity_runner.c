@@ -3,6 +3,12 @@
 /* Test functions (extern) ---------------------------------------------------*/
 
 extern void test_slist_create_should_return_not_null(void);
+extern void test_slist_load_mmap_should_restore_saved_list(void);
+extern void test_slist_load_mmap_should_copy_on_write(void);
+extern void test_slist_init_should_use_only_provided_nodes(void);
+extern void test_slist_insert_sorted_should_keep_order(void);
+extern void test_slist_merge_k_should_merge_into_first_list(void);
+extern void test_slist_sort_should_order_negative_values_first(void);
 
 /* Main ----------------------------------------------------------------------*/
 
@@ -11,6 +17,12 @@ int main(void)
     UNITY_BEGIN();
 
     RUN_TEST(test_slist_create_should_return_not_null);
+    RUN_TEST(test_slist_load_mmap_should_restore_saved_list);
+    RUN_TEST(test_slist_load_mmap_should_copy_on_write);
+    RUN_TEST(test_slist_init_should_use_only_provided_nodes);
+    RUN_TEST(test_slist_insert_sorted_should_keep_order);
+    RUN_TEST(test_slist_merge_k_should_merge_into_first_list);
+    RUN_TEST(test_slist_sort_should_order_negative_values_first);
 
     return UNITY_END();
 }
\ No newline at end of file
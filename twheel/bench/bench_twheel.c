@@ -0,0 +1,250 @@
+/*******************************************************************************
+ *
+ * @file    bench_twheel.c
+ * @brief   Benchmark of the timing wheel versus a binary min-heap of timers.
+ * @details TIMER_COUNT timers with random deadlines within DEADLINE_RANGE
+ *          ticks are armed, every CANCEL_STRIDE-th one is cancelled, and time
+ *          is advanced until all remaining timers have fired. The heap stands
+ *          in for the sorted structure it replaces: O(log n) insertion and
+ *          removal, with cancelled timers skipped when they reach the top.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Build from the module root (e.g., datastructures-and-algorithms/
+ *          twheel):
+ *          $ gcc -O2 -I. twheel.c bench/bench_twheel.c -o bench_twheel
+ *          Needs about 600 MB of memory for 10M timers.
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "twheel.h"
+
+#define TIMER_COUNT     (10000000U)
+#define DEADLINE_RANGE  (1U << 20)  /* About 17 minutes in ms ticks. */
+#define CANCEL_STRIDE   (4U)
+#define ADVANCE_STEP    (16U)       /* Ticks per twheel_advance() call. */
+
+typedef struct
+{
+    uint64_t expires;
+    bool b_cancelled;
+} heap_timer_t;
+
+static uint64_t g_fired;
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/* xorshift64: a fast, reproducible deadline generator. */
+static uint64_t next_rand(uint64_t *p_state)
+{
+    *p_state ^= *p_state << 13;
+    *p_state ^= *p_state >> 7;
+    *p_state ^= *p_state << 17;
+
+    return *p_state;
+}
+
+static void on_expire(twheel_timer_t *p_timer, void *p_arg)
+{
+    (void)p_timer;
+    (void)p_arg;
+
+    g_fired++;
+}
+
+static void heap_push(heap_timer_t **pp_heap, uint32_t *p_size,
+                      heap_timer_t *p_timer)
+{
+    uint32_t idx = (*p_size)++;
+
+    while (idx > 0)
+    {
+        uint32_t parent = (idx - 1U) / 2U;
+        if (pp_heap[parent]->expires <= p_timer->expires)
+        {
+            break;
+        }
+        pp_heap[idx] = pp_heap[parent];
+        idx = parent;
+    }
+    pp_heap[idx] = p_timer;
+}
+
+static heap_timer_t* heap_pop(heap_timer_t **pp_heap, uint32_t *p_size)
+{
+    heap_timer_t *p_top = pp_heap[0];
+    heap_timer_t *p_last = pp_heap[--(*p_size)];
+    uint32_t idx = 0;
+
+    for (;;)
+    {
+        uint32_t child = (2U * idx) + 1U;
+        if (child >= *p_size)
+        {
+            break;
+        }
+        if (((child + 1U) < *p_size) &&
+            (pp_heap[child + 1U]->expires < pp_heap[child]->expires))
+        {
+            child++;
+        }
+        if (p_last->expires <= pp_heap[child]->expires)
+        {
+            break;
+        }
+        pp_heap[idx] = pp_heap[child];
+        idx = child;
+    }
+    pp_heap[idx] = p_last;
+
+    return p_top;
+}
+
+static int bench_wheel(double *p_add_ns, double *p_total_s)
+{
+    twheel_timer_t *p_timers = malloc(TIMER_COUNT * sizeof(twheel_timer_t));
+    twheel_t *p_wheel = twheel_create(0);
+    uint64_t seed = 88172645463325252ULL;
+
+    if (NULL == p_timers || NULL == p_wheel)
+    {
+        free(p_timers);
+        twheel_destroy(p_wheel);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    {
+        twheel_timer_init(&p_timers[i], on_expire, NULL);
+    }
+
+    double start = now_s();
+    for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    {
+        twheel_add(p_wheel, &p_timers[i],
+                   1U + (next_rand(&seed) % DEADLINE_RANGE));
+    }
+    double added = now_s();
+
+    for (uint32_t i = 0; i < TIMER_COUNT; i += CANCEL_STRIDE)
+    {
+        twheel_cancel(p_wheel, &p_timers[i]);
+    }
+
+    g_fired = 0;
+    for (uint64_t t = ADVANCE_STEP; t <= DEADLINE_RANGE + ADVANCE_STEP;
+         t += ADVANCE_STEP)
+    {
+        twheel_advance(p_wheel, t);
+    }
+    double stop = now_s();
+
+    *p_add_ns = (added - start) * 1e9 / TIMER_COUNT;
+    *p_total_s = stop - start;
+
+    twheel_destroy(p_wheel);
+    free(p_timers);
+
+    return 0;
+}
+
+static int bench_heap(double *p_add_ns, double *p_total_s)
+{
+    heap_timer_t *p_timers = malloc(TIMER_COUNT * sizeof(heap_timer_t));
+    heap_timer_t **pp_heap = malloc(TIMER_COUNT * sizeof(heap_timer_t *));
+    uint32_t size = 0;
+    uint64_t seed = 88172645463325252ULL;
+
+    if (NULL == p_timers || NULL == pp_heap)
+    {
+        free(p_timers);
+        free(pp_heap);
+        return -1;
+    }
+
+    double start = now_s();
+    for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    {
+        p_timers[i].expires = 1U + (next_rand(&seed) % DEADLINE_RANGE);
+        p_timers[i].b_cancelled = false;
+        heap_push(pp_heap, &size, &p_timers[i]);
+    }
+    double added = now_s();
+
+    for (uint32_t i = 0; i < TIMER_COUNT; i += CANCEL_STRIDE)
+    {
+        p_timers[i].b_cancelled = true;
+    }
+
+    g_fired = 0;
+    for (uint64_t t = ADVANCE_STEP; t <= DEADLINE_RANGE + ADVANCE_STEP;
+         t += ADVANCE_STEP)
+    {
+        while ((size > 0) && (pp_heap[0]->expires <= t))
+        {
+            heap_timer_t *p_timer = heap_pop(pp_heap, &size);
+            if (!p_timer->b_cancelled)
+            {
+                on_expire(NULL, NULL);
+            }
+        }
+    }
+    double stop = now_s();
+
+    *p_add_ns = (added - start) * 1e9 / TIMER_COUNT;
+    *p_total_s = stop - start;
+
+    free(pp_heap);
+    free(p_timers);
+
+    return 0;
+}
+
+int main(void)
+{
+    double wheel_add_ns;
+    double wheel_total_s;
+    double heap_add_ns;
+    double heap_total_s;
+
+    if (0 != bench_wheel(&wheel_add_ns, &wheel_total_s))
+    {
+        printf("Error: out of memory\n");
+        return 1;
+    }
+    uint64_t wheel_fired = g_fired;
+
+    if (0 != bench_heap(&heap_add_ns, &heap_total_s))
+    {
+        printf("Error: out of memory\n");
+        return 1;
+    }
+
+    if (wheel_fired != g_fired)
+    {
+        printf("Error: fired %llu != %llu\n", (unsigned long long)wheel_fired,
+               (unsigned long long)g_fired);
+        return 1;
+    }
+
+    printf("%u timers, %llu fired\n", TIMER_COUNT,
+           (unsigned long long)g_fired);
+    printf("%-8s %14s %12s\n", "", "add (ns/timer)", "total (s)");
+    printf("%-8s %14.2f %12.3f\n", "wheel", wheel_add_ns, wheel_total_s);
+    printf("%-8s %14.2f %12.3f\n", "heap", heap_add_ns, heap_total_s);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: bench_twheel.c ***/
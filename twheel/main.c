@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *
+ * @file    main.c
+ * @brief   Test driver for the timing wheel module.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "twheel.h"
+
+static twheel_t *g_p_wheel;
+
+static void on_timeout(twheel_timer_t *p_timer, void *p_arg)
+{
+    (void)p_timer;
+
+    printf("%llu: %s\n", (unsigned long long)twheel_now(g_p_wheel),
+           (const char *)p_arg);
+}
+
+static void on_tick(twheel_timer_t *p_timer, void *p_arg)
+{
+    int *p_remaining = p_arg;
+
+    printf("%llu: tick\n", (unsigned long long)twheel_now(g_p_wheel));
+    if (--(*p_remaining) > 0)
+    {
+        /* Periodic timer: re-arm from the callback. */
+        twheel_add(g_p_wheel, p_timer, p_timer->expires + 100);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    twheel_timer_t conn_a;
+    twheel_timer_t conn_b;
+    twheel_timer_t conn_c;
+    twheel_timer_t tick;
+    int tick_count = 3;
+
+    g_p_wheel = twheel_create(0);
+    twheel_timer_init(&conn_a, on_timeout, "conn a");
+    twheel_timer_init(&conn_b, on_timeout, "conn b");
+    twheel_timer_init(&conn_c, on_timeout, "conn c");
+    twheel_timer_init(&tick, on_tick, &tick_count);
+
+    twheel_add(g_p_wheel, &conn_a, 150);
+    twheel_add(g_p_wheel, &conn_b, 70000);  /* Level 2: cascaded twice. */
+    twheel_add(g_p_wheel, &conn_c, 250);
+    twheel_add(g_p_wheel, &tick, 100);
+    printf("%llu\n", (unsigned long long)twheel_pending_count(g_p_wheel)); /* 4 */
+
+    twheel_cancel(g_p_wheel, &conn_c);      /* Dropped when its slot comes. */
+    twheel_add(g_p_wheel, &conn_a, 280);    /* Activity: push back timeout. */
+    printf("%d\n", twheel_add(g_p_wheel, &conn_a, 10)); /* 0 */
+
+    printf("%llu\n", (unsigned long long)twheel_advance(g_p_wheel, 1000));
+    /* 100: tick
+     * 200: tick
+     * 280: conn a
+     * 300: tick
+     * 4 */
+
+    printf("%llu\n", (unsigned long long)twheel_advance(g_p_wheel, 100000));
+    /* 70000: conn b
+     * 1 */
+
+    printf("%d\n", twheel_timer_is_linked(&conn_c)); /* 0 */
+    twheel_destroy(g_p_wheel);
+
+    return 0;
+} /* End of main() */
+
+/*** End of file: main.c ***/
@@ -0,0 +1,462 @@
+/*******************************************************************************
+ *
+ * @file    twheel.c
+ * @brief   Implementation of a hierarchical timing wheel.
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    The definition of twheel_t is intentionally kept private to this
+ *          source file to enforce encapsulation. Users of this module interact
+ *          with the wheel only through the public API and cannot access or
+ *          modify internal members directly.
+ *
+ ******************************************************************************/
+
+#include "twheel.h"
+#include <stdlib.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+#define TWHEEL_SLOT_MASK        (TWHEEL_SLOT_COUNT - 1U)
+#define TWHEEL_SPAN             (1ULL << (TWHEEL_SLOT_BITS * TWHEEL_LEVEL_COUNT))
+
+#define TWHEEL_STATE_IDLE       (0U)    /* Not linked into any slot. */
+#define TWHEEL_STATE_PENDING    (1U)    /* Linked and armed. */
+#define TWHEEL_STATE_CANCELLED  (2U)    /* Linked until its slot is reached. */
+
+/* Private data types --------------------------------------------------------*/
+
+/*!
+ * @brief Slot of the wheel: a singly linked list of timers.
+ * @note Like slist_t, the tail pointer makes appending a timer O(1), and a
+ * whole slot is taken by copying the two pointers.
+ */
+typedef struct
+{
+    twheel_timer_t *p_head;
+    twheel_timer_t *p_tail;
+} twheel_slot_t;
+
+/*!
+ * @brief Structure representing a timing wheel.
+ * @note This structure is opaque to users of the API. A timer is linked into
+ * level l at slot (expires >> (l * TWHEEL_SLOT_BITS)) & TWHEEL_SLOT_MASK, where
+ * l is the lowest level whose span covers the time left until it expires.
+ */
+struct twheel_t
+{
+    twheel_slot_t slots[TWHEEL_LEVEL_COUNT][TWHEEL_SLOT_COUNT];
+    uint64_t now;
+    uint64_t linked;    /* Timers in any slot, including cancelled ones. */
+    uint64_t pending;   /* Linked timers that have not been cancelled. */
+};
+
+/* Private function prototypes -----------------------------------------------*/
+
+static void twheel_link(twheel_t *p_wheel, twheel_timer_t *p_timer,
+                        uint64_t earliest);
+static twheel_timer_t* twheel_slot_take(twheel_slot_t *p_slot);
+static void twheel_cascade(twheel_t *p_wheel, uint32_t level);
+static uint64_t twheel_expire(twheel_t *p_wheel);
+
+/* Public API definitions ----------------------------------------------------*/
+
+/*!
+ * @brief Creates and initializes a timing wheel.
+ * @param[in] now Current time, in ticks.
+ * @return Pointer to the created wheel, or NULL if memory allocation fails.
+ * @note Time complexity: O(1)
+ * @note The caller owns the returned object, and is responsible for destroying
+ * it by calling twheel_destroy().
+ */
+twheel_t* twheel_create(uint64_t now)
+{
+    /* Zeroed memory leaves every slot empty. */
+    twheel_t *p_wheel = calloc(1, sizeof(twheel_t));
+    if (NULL == p_wheel)
+    {
+        /* Memory allocation failed. */
+        return NULL;
+    }
+
+    p_wheel->now = now;
+
+    return p_wheel;
+} /* End of twheel_create() */
+
+/*!
+ * @brief Initializes a timer before its first use.
+ * @param[out] p_timer Pointer to the timer.
+ * @param[in] cb Function to call when the timer expires.
+ * @param[in] p_arg Argument passed to cb.
+ * @note Time complexity: O(1)
+ * @note Must not be called on a timer that is linked into a wheel.
+ */
+void twheel_timer_init(twheel_timer_t *p_timer, twheel_cb_t cb, void *p_arg)
+{
+    if (NULL == p_timer)
+    {
+        return;
+    }
+
+    p_timer->expires = 0;
+    p_timer->cb = cb;
+    p_timer->p_arg = p_arg;
+    p_timer->p_next = NULL;
+    p_timer->state = TWHEEL_STATE_IDLE;
+} /* End of twheel_timer_init() */
+
+/*!
+ * @brief Arms a timer to expire at a given time.
+ * @param[in,out] p_wheel Pointer to the wheel.
+ * @param[in,out] p_timer Pointer to the timer.
+ * @param[in] expires Deadline, in ticks. A deadline that is not in the future
+ * expires on the next tick.
+ * @return true If the timer was armed.
+ * @return false If p_wheel or p_timer is NULL, or if the timer is still
+ * linked and expires is earlier than its previous deadline.
+ * @note Time complexity: O(1)
+ * @note A timer that is still linked (pending, or cancelled but not yet
+ * dropped) is not moved: only its deadline is updated, and it is re-linked
+ * when the wheel reaches its old slot. This makes pushing back a deadline,
+ * as done for idle timeouts, O(1) without unlinking.
+ */
+bool twheel_add(twheel_t *p_wheel, twheel_timer_t *p_timer, uint64_t expires)
+{
+    if (NULL == p_wheel || NULL == p_timer)
+    {
+        return false;
+    }
+
+    if (TWHEEL_STATE_IDLE != p_timer->state)
+    {
+        /* Still linked: its slot is due no later than the old deadline. */
+        if (expires < p_timer->expires)
+        {
+            return false;
+        }
+
+        p_timer->expires = expires;
+        if (TWHEEL_STATE_CANCELLED == p_timer->state)
+        {
+            p_timer->state = TWHEEL_STATE_PENDING;
+            p_wheel->pending++;
+        }
+        return true;
+    }
+
+    p_timer->expires = expires;
+    p_timer->state = TWHEEL_STATE_PENDING;
+    twheel_link(p_wheel, p_timer, p_wheel->now + 1U);
+    p_wheel->linked++;
+    p_wheel->pending++;
+
+    return true;
+} /* End of twheel_add() */
+
+/*!
+ * @brief Cancels a pending timer.
+ * @param[in,out] p_wheel Pointer to the wheel.
+ * @param[in,out] p_timer Pointer to the timer.
+ * @return true If the timer was pending and will not fire.
+ * @return false If p_wheel or p_timer is NULL, or the timer was not pending.
+ * @note Time complexity: O(1)
+ * @note Cancellation is lazy: since slots are singly linked, the timer stays
+ * linked until the wheel reaches its slot and drops it. Its memory must stay
+ * valid until twheel_timer_is_linked() returns false.
+ */
+bool twheel_cancel(twheel_t *p_wheel, twheel_timer_t *p_timer)
+{
+    if (NULL == p_wheel || NULL == p_timer)
+    {
+        return false;
+    }
+
+    if (TWHEEL_STATE_PENDING != p_timer->state)
+    {
+        return false;
+    }
+
+    p_timer->state = TWHEEL_STATE_CANCELLED;
+    p_wheel->pending--;
+
+    return true;
+} /* End of twheel_cancel() */
+
+/*!
+ * @brief Checks whether a timer is armed.
+ * @param[in] p_timer Pointer to the timer.
+ * @return true If the timer will fire unless cancelled.
+ * @return false If the timer is idle or cancelled, or p_timer is NULL.
+ * @note Time complexity: O(1)
+ */
+bool twheel_timer_is_pending(const twheel_timer_t *p_timer)
+{
+    if (NULL == p_timer)
+    {
+        return false;
+    }
+
+    return (TWHEEL_STATE_PENDING == p_timer->state);
+} /* End of twheel_timer_is_pending() */
+
+/*!
+ * @brief Checks whether a timer is still referenced by a wheel.
+ * @param[in] p_timer Pointer to the timer.
+ * @return true If the timer is pending, or cancelled but not yet dropped.
+ * @return false If the timer may be released or re-initialized, or p_timer is
+ * NULL.
+ * @note Time complexity: O(1)
+ */
+bool twheel_timer_is_linked(const twheel_timer_t *p_timer)
+{
+    if (NULL == p_timer)
+    {
+        return false;
+    }
+
+    return (TWHEEL_STATE_IDLE != p_timer->state);
+} /* End of twheel_timer_is_linked() */
+
+/*!
+ * @brief Advances the wheel to a given time and fires the expired timers.
+ * @param[in,out] p_wheel Pointer to the wheel.
+ * @param[in] now New current time, in ticks.
+ * @return Number of timers fired. Returns 0 if p_wheel is NULL or now is not
+ * later than the current time of the wheel.
+ * @note Time complexity: O(t + e), where t is the number of ticks advanced and
+ * e the number of timers fired, cascaded or dropped. Each timer is cascaded
+ * at most TWHEEL_LEVEL_COUNT - 1 times, so the cost per timer is O(1).
+ * @note Timers fire in deadline order across ticks; timers expiring on the
+ * same tick fire in the order they were linked into its slot.
+ */
+uint64_t twheel_advance(twheel_t *p_wheel, uint64_t now)
+{
+    if (NULL == p_wheel)
+    {
+        return 0;
+    }
+
+    uint64_t fired = 0;
+
+    while (p_wheel->now < now)
+    {
+        if (0 == p_wheel->linked)
+        {
+            /* Nothing to cascade or fire: jump straight to now. */
+            p_wheel->now = now;
+            break;
+        }
+
+        p_wheel->now++;
+
+        /* Find the highest level whose slot boundary has been reached. */
+        uint32_t level = 0;
+        while (((level + 1U) < TWHEEL_LEVEL_COUNT) &&
+               (0 == ((p_wheel->now >> (level * TWHEEL_SLOT_BITS)) &
+                      TWHEEL_SLOT_MASK)))
+        {
+            level++;
+        }
+
+        /* Cascade from the top, so each level is refilled before its own
+         * slot is taken. */
+        for (; level > 0; level--)
+        {
+            twheel_cascade(p_wheel, level);
+        }
+
+        fired += twheel_expire(p_wheel);
+    }
+
+    return fired;
+} /* End of twheel_advance() */
+
+/*!
+ * @brief Returns the current time of the wheel.
+ * @param[in] p_wheel Pointer to the wheel.
+ * @return Current time, in ticks. Returns 0 if p_wheel is NULL.
+ * @note Time complexity: O(1)
+ */
+uint64_t twheel_now(const twheel_t *p_wheel)
+{
+    if (NULL == p_wheel)
+    {
+        return 0;
+    }
+
+    return p_wheel->now;
+} /* End of twheel_now() */
+
+/*!
+ * @brief Counts the timers that are armed.
+ * @param[in] p_wheel Pointer to the wheel.
+ * @return Number of pending timers. Returns 0 if p_wheel is NULL.
+ * @note Time complexity: O(1)
+ */
+uint64_t twheel_pending_count(const twheel_t *p_wheel)
+{
+    if (NULL == p_wheel)
+    {
+        return 0;
+    }
+
+    return p_wheel->pending;
+} /* End of twheel_pending_count() */
+
+/*!
+ * @brief Destroys a timing wheel.
+ * @param[in] p_wheel Pointer to the wheel.
+ * @note Time complexity: O(1)
+ * @note It is safe to call this function with a NULL pointer.
+ * @note Linked timers are not touched; they are owned by the caller and must
+ * not be used with this wheel again.
+ */
+void twheel_destroy(twheel_t *p_wheel)
+{
+    free(p_wheel);
+} /* End of twheel_destroy() */
+
+/* Private function definitions ----------------------------------------------*/
+
+/*!
+ * @brief Appends a timer to the slot matching its deadline.
+ * @param[in,out] p_wheel Pointer to the wheel.
+ * @param[in,out] p_timer Timer to link; its state is left unchanged.
+ * @param[in] earliest First tick whose level-0 slot has not been expired yet:
+ * now while a tick is being processed, now + 1 otherwise.
+ * @note Time complexity: O(1)
+ */
+static void twheel_link(twheel_t *p_wheel, twheel_timer_t *p_timer,
+                        uint64_t earliest)
+{
+    uint64_t expires = p_timer->expires;
+
+    if (expires < earliest)
+    {
+        /* Already due: fire on the earliest tick still to be expired. */
+        expires = earliest;
+    }
+    else if ((expires - p_wheel->now) >= TWHEEL_SPAN)
+    {
+        /* Beyond the last level: park it, it is re-linked when reached. */
+        expires = p_wheel->now + TWHEEL_SPAN - 1U;
+    }
+
+    uint64_t delta = expires - p_wheel->now;
+    uint32_t level = 0;
+    while (((level + 1U) < TWHEEL_LEVEL_COUNT) &&
+           (delta >= (1ULL << ((level + 1U) * TWHEEL_SLOT_BITS))))
+    {
+        level++;
+    }
+
+    twheel_slot_t *p_slot = &p_wheel->slots[level]
+        [(expires >> (level * TWHEEL_SLOT_BITS)) & TWHEEL_SLOT_MASK];
+
+    p_timer->p_next = NULL;
+    if (NULL == p_slot->p_tail)
+    {
+        p_slot->p_head = p_timer;
+    }
+    else
+    {
+        p_slot->p_tail->p_next = p_timer;
+    }
+    p_slot->p_tail = p_timer;
+} /* End of twheel_link() */
+
+/*!
+ * @brief Detaches all timers of a slot.
+ * @param[in,out] p_slot Pointer to the slot, which is empty on return.
+ * @return Head of the detached list of timers, or NULL if the slot was empty.
+ * @note Time complexity: O(1)
+ */
+static twheel_timer_t* twheel_slot_take(twheel_slot_t *p_slot)
+{
+    twheel_timer_t *p_head = p_slot->p_head;
+
+    p_slot->p_head = NULL;
+    p_slot->p_tail = NULL;
+
+    return p_head;
+} /* End of twheel_slot_take() */
+
+/*!
+ * @brief Re-links the timers of the current slot of a level into the levels
+ * below.
+ * @param[in,out] p_wheel Pointer to the wheel.
+ * @param[in] level Level to cascade, at least 1.
+ * @note Time complexity: O(n), where n is the number of timers in the slot.
+ * Cancelled timers are dropped here.
+ */
+static void twheel_cascade(twheel_t *p_wheel, uint32_t level)
+{
+    uint32_t idx = (uint32_t)(p_wheel->now >> (level * TWHEEL_SLOT_BITS)) &
+                   TWHEEL_SLOT_MASK;
+    twheel_timer_t *p_timer = twheel_slot_take(&p_wheel->slots[level][idx]);
+
+    while (NULL != p_timer)
+    {
+        twheel_timer_t *p_next = p_timer->p_next;
+
+        if (TWHEEL_STATE_CANCELLED == p_timer->state)
+        {
+            p_timer->state = TWHEEL_STATE_IDLE;
+            p_wheel->linked--;
+        }
+        else
+        {
+            /* A timer due now lands in the level-0 slot about to expire. */
+            twheel_link(p_wheel, p_timer, p_wheel->now);
+        }
+
+        p_timer = p_next;
+    }
+} /* End of twheel_cascade() */
+
+/*!
+ * @brief Fires the timers of the current level-0 slot.
+ * @param[in,out] p_wheel Pointer to the wheel.
+ * @return Number of timers fired.
+ * @note Time complexity: O(n), where n is the number of timers in the slot.
+ * Timers whose deadline was pushed back are re-linked instead of fired.
+ */
+static uint64_t twheel_expire(twheel_t *p_wheel)
+{
+    uint32_t idx = (uint32_t)p_wheel->now & TWHEEL_SLOT_MASK;
+    twheel_timer_t *p_timer = twheel_slot_take(&p_wheel->slots[0][idx]);
+    uint64_t fired = 0;
+
+    while (NULL != p_timer)
+    {
+        /* Read the link first: the callback may re-add or release p_timer. */
+        twheel_timer_t *p_next = p_timer->p_next;
+
+        if (TWHEEL_STATE_CANCELLED == p_timer->state)
+        {
+            p_timer->state = TWHEEL_STATE_IDLE;
+            p_wheel->linked--;
+        }
+        else if (p_timer->expires > p_wheel->now)
+        {
+            twheel_link(p_wheel, p_timer, p_wheel->now + 1U);
+        }
+        else
+        {
+            p_timer->state = TWHEEL_STATE_IDLE;
+            p_wheel->linked--;
+            p_wheel->pending--;
+            fired++;
+            if (NULL != p_timer->cb)
+            {
+                p_timer->cb(p_timer, p_timer->p_arg);
+            }
+        }
+
+        p_timer = p_next;
+    }
+
+    return fired;
+} /* End of twheel_expire() */
+
+/*** End of file: twheel.c */
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *
+ * @file    twheel.h
+ * @brief   Public APIs for a hierarchical timing wheel.
+ * @details This module schedules large numbers of timers in O(1) per timer.
+ *          The wheel has TWHEEL_LEVEL_COUNT levels of TWHEEL_SLOT_COUNT slots;
+ *          each level covers TWHEEL_SLOT_COUNT times the span of the level
+ *          below. A timer is linked into the slot of the level that matches
+ *          how far away its deadline is, and whole slots are spliced down to
+ *          the level below (cascaded) as time reaches them. Each slot is a
+ *          singly linked list with a tail pointer, like slist_t, so adding a
+ *          timer and splicing a slot are both O(1).
+ * @author  Kyungjae Lee
+ * @date    Oct 17, 2026
+ * @note    Timers are intrusive: the caller owns each twheel_timer_t and the
+ *          wheel only links it. Time is an abstract tick count chosen by the
+ *          caller (e.g., milliseconds).
+ *
+ ******************************************************************************/
+
+#ifndef TWHEEL_H
+#define TWHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Macros --------------------------------------------------------------------*/
+
+#define TWHEEL_SLOT_BITS    (8U)
+#define TWHEEL_SLOT_COUNT   (1U << TWHEEL_SLOT_BITS)
+#define TWHEEL_LEVEL_COUNT  (4U)    /* Spans 2^32 ticks; later deadlines are
+                                     * parked in the last level. */
+
+/* Opaque type declarations --------------------------------------------------*/
+
+typedef struct twheel_t twheel_t;
+
+/* Public data types ---------------------------------------------------------*/
+
+typedef struct twheel_timer_t twheel_timer_t;
+
+/*!
+ * @brief Function called when a timer expires.
+ * @param[in] p_timer The expired timer. It is no longer linked, so the
+ * callback may add it again (e.g., for a periodic timer) or release it.
+ * @param[in] p_arg Argument given to twheel_timer_init().
+ */
+typedef void (*twheel_cb_t)(twheel_timer_t *p_timer, void *p_arg);
+
+/*!
+ * @brief Timer owned by the caller and linked into a wheel.
+ * @note Initialize with twheel_timer_init(). Members other than expires are
+ * private to the wheel; expires is the deadline given to twheel_add() and
+ * may be read at any time.
+ */
+struct twheel_timer_t
+{
+    uint64_t expires;
+    twheel_cb_t cb;
+    void *p_arg;
+    struct twheel_timer_t *p_next;
+    uint8_t state;
+};
+
+/* Public APIs ---------------------------------------------------------------*/
+
+twheel_t* twheel_create(uint64_t now);
+void twheel_timer_init(twheel_timer_t *p_timer, twheel_cb_t cb, void *p_arg);
+bool twheel_add(twheel_t *p_wheel, twheel_timer_t *p_timer, uint64_t expires);
+bool twheel_cancel(twheel_t *p_wheel, twheel_timer_t *p_timer);
+bool twheel_timer_is_pending(const twheel_timer_t *p_timer);
+bool twheel_timer_is_linked(const twheel_timer_t *p_timer);
+uint64_t twheel_advance(twheel_t *p_wheel, uint64_t now);
+uint64_t twheel_now(const twheel_t *p_wheel);
+uint64_t twheel_pending_count(const twheel_t *p_wheel);
+void twheel_destroy(twheel_t *p_wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TWHEEL_H */
+
+/*** End of file: twheel.h */